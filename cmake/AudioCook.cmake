@@ -0,0 +1,91 @@
+# Cook WAV sources into compressed audio next to the executable
+#
+#   cook_audio (<wav> STREAM)   long tracks streamed by sf::Music      -> .ogg (Vorbis)
+#   cook_audio (<wav> DECODE)   short SFX decoded once into memory     -> .flac (lossless)
+#   cook_audio (<wav> DECODE MONO)  downmixed - for sounds played positionally, which
+#                                   OpenAL only spatializes when the buffer is mono
+#
+# Uses oggenc / flac when installed, ffmpeg otherwise. Without an encoder the WAV
+# is copied unchanged - the game resolves .ogg/.flac/.wav at runtime (AudioManager).
+# Set COOK_AUDIO=OFF to always ship the WAVs.
+
+option (COOK_AUDIO "Compress audio assets at build time" ON)
+
+find_program (OGGENC_EXECUTABLE oggenc)
+find_program (FLAC_EXECUTABLE flac)
+find_program (FFMPEG_EXECUTABLE ffmpeg)
+
+set (AUDIO_OGG_QUALITY 5)
+set_property (GLOBAL PROPERTY COOKED_AUDIO_FILES "")
+
+function (cook_audio SOURCE MODE)
+    set (MONO OFF)
+    if ("MONO" IN_LIST ARGN)
+        set (MONO ON)
+    endif ()
+
+    get_filename_component (SOURCE_PATH "${SOURCE}" ABSOLUTE)
+    get_filename_component (SOURCE_NAME "${SOURCE}" NAME_WE)
+
+    if (NOT EXISTS "${SOURCE_PATH}")
+        message (WARNING "Audio asset not found, skipped: ${SOURCE}")
+        return ()
+    endif ()
+
+    set (COMMAND_LINE "")
+    if (COOK_AUDIO AND MODE STREQUAL "STREAM")
+        set (OUTPUT "${CMAKE_BINARY_DIR}/${SOURCE_NAME}.ogg")
+        if (OGGENC_EXECUTABLE)
+            set (COMMAND_LINE "${OGGENC_EXECUTABLE}" --quiet -q ${AUDIO_OGG_QUALITY})
+            if (MONO)
+                list (APPEND COMMAND_LINE --downmix)
+            endif ()
+            list (APPEND COMMAND_LINE -o "${OUTPUT}" "${SOURCE_PATH}")
+        elseif (FFMPEG_EXECUTABLE)
+            set (COMMAND_LINE "${FFMPEG_EXECUTABLE}" -y -loglevel error -i "${SOURCE_PATH}")
+            if (MONO)
+                list (APPEND COMMAND_LINE -ac 1)
+            endif ()
+            list (APPEND COMMAND_LINE -c:a libvorbis -q:a ${AUDIO_OGG_QUALITY} "${OUTPUT}")
+        endif ()
+    elseif (COOK_AUDIO AND MODE STREQUAL "DECODE")
+        set (OUTPUT "${CMAKE_BINARY_DIR}/${SOURCE_NAME}.flac")
+        # flac cannot downmix - prefer ffmpeg for mono sounds (AudioManager downmixes otherwise)
+        if (FLAC_EXECUTABLE AND NOT (MONO AND FFMPEG_EXECUTABLE))
+            set (COMMAND_LINE "${FLAC_EXECUTABLE}" --silent --best -f -o "${OUTPUT}" "${SOURCE_PATH}")
+        elseif (FFMPEG_EXECUTABLE)
+            set (COMMAND_LINE "${FFMPEG_EXECUTABLE}" -y -loglevel error -i "${SOURCE_PATH}")
+            if (MONO)
+                list (APPEND COMMAND_LINE -ac 1)
+            endif ()
+            list (APPEND COMMAND_LINE -c:a flac -compression_level 8 "${OUTPUT}")
+        endif ()
+    endif ()
+
+    if (NOT COMMAND_LINE)
+        # Cooked files from an earlier build would take precedence at runtime
+        file (REMOVE "${CMAKE_BINARY_DIR}/${SOURCE_NAME}.ogg" "${CMAKE_BINARY_DIR}/${SOURCE_NAME}.flac")
+        configure_file ("${SOURCE_PATH}" ${CMAKE_BINARY_DIR} COPYONLY)
+        return ()
+    endif ()
+
+    # Drop a WAV copied by an earlier configure that had no encoder
+    file (REMOVE "${CMAKE_BINARY_DIR}/${SOURCE_NAME}.wav")
+
+    add_custom_command (
+        OUTPUT "${OUTPUT}"
+        COMMAND ${COMMAND_LINE}
+        DEPENDS "${SOURCE_PATH}"
+        COMMENT "Cooking audio ${SOURCE_NAME}"
+        VERBATIM)
+    set_property (GLOBAL APPEND PROPERTY COOKED_AUDIO_FILES "${OUTPUT}")
+endfunction ()
+
+# Call once after all cook_audio() calls
+function (add_cooked_audio_target)
+    get_property (COOKED_FILES GLOBAL PROPERTY COOKED_AUDIO_FILES)
+    if (COOKED_FILES)
+        add_custom_target (CookAudio ALL DEPENDS ${COOKED_FILES})
+        add_dependencies (${CMAKE_PROJECT_NAME} CookAudio)
+    endif ()
+endfunction ()
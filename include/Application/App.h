@@ -23,6 +23,7 @@ private:
     // Application lifecycle
     void initialize();
     void cleanup();
+    void applyVideoSettings();
 
     // SRP Components - each handles one responsibility
     std::unique_ptr<WindowManager> m_windowManager;
@@ -12,6 +12,8 @@
  * - SoundLoader: Sound effect management
  * - ScreenManager: Screen and UI management
  * - CommandInvoker: Command pattern execution
+ * - LayoutManager: Virtual-resolution view and anchored layout
+ * - HighScoreTable: Top scores from highScore.txt
  *
  * Usage: AppContext::instance().serviceName().method()
  */
@@ -19,6 +21,8 @@
 #include <memory>
 #include "ResourceLoader.h"  // Template version
 #include "ScreenManager.h"
+#include "LayoutManager.h"
+#include "HighScoreTable.h"
 #include <CommandInvoker.h>
 #include <AudioSettingsManager.h>
 
@@ -34,6 +38,8 @@ public:
     // Other services
     ScreenManager& screenManager();
     CommandInvoker& commandInvoker();
+    LayoutManager& layout();
+    HighScoreTable& highScores();
 
     // Backward compatibility methods (optional - for easy migration)
     sf::Texture& getTexture(const std::string& filename) {
@@ -64,4 +70,6 @@ private:
     // Other services
     std::unique_ptr<ScreenManager> m_screenManager;
     std::unique_ptr<CommandInvoker> m_commandInvoker;
+    std::unique_ptr<LayoutManager> m_layoutManager;
+    std::unique_ptr<HighScoreTable> m_highScores;
 };
\ No newline at end of file
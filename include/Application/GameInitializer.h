@@ -1,9 +1,13 @@
 #pragma once
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include "AppContext.h"
 #include "ScreenTypes.h"
 #include "../Core/AudioManager.h"
 #include "../Core/AudioSettingsManager.h"
+#include "../Core/SettingsPersistence.h"
+#include "../Core/ProfileStore.h"
 #include "Logger.h"
 
 // Screens
@@ -12,6 +16,9 @@
 #include "../Screens/SettingsScreen.h"
 #include "../Screens/AboutScreen.h"
 #include "../Screens/HelpScreen.h"
+#include "../Screens/PlayScreen.h"
+#include "../Screens/GameOverScreen.h"
+#include "../Screens/WinningScreen.h"
 
 class GameInitializer {
 public:
@@ -21,6 +28,8 @@ public:
     void initializeAllSystems();
 
 private:
+    void loadUserProfile();
+    void loadHighScores();
     void initializeAudioSystem();
     void initializeResourceSystem();
     void registerAllScreens();
@@ -28,6 +37,7 @@ private:
     void loadDefaultAudioFiles();
     void setDefaultAudioVolumes();
     void registerScreenFactories();
+    void registerScreenMusic();
 
     void handleInitializationError(const std::string& system, const std::string& error);
 };
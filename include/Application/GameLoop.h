@@ -1,5 +1,7 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include "InputQueue.h"
+#include "ProfilerOverlay.h"
 
 class WindowManager;
 
@@ -17,15 +19,23 @@ public:
 private:
     // Loop components
     void processFrame();
+    void processInput();
+    void handleSystemEvent(const InputEvent& input);
+    bool handleDebugKey(const InputEvent& input);
+    void reportLatency() const;
     void updateGame(float deltaTime);
     void renderGame();
+    void updateLayout();
 
     // Frame timing
     float calculateDeltaTime();
 
     WindowManager& m_windowManager;
     sf::Clock m_clock;
+    InputQueue m_inputQueue;
+    ProfilerOverlay m_profilerOverlay;
 
     // Performance tracking
     static constexpr float MAX_DELTA_TIME = 1.0f / 30.0f; // Cap at 30 FPS minimum
+    static constexpr const char* LATENCY_REPORT_PATH = "latency_report.txt";
 };
@@ -23,6 +23,11 @@ public:
      */
     bool handleKeyboardInput(const sf::Event& event);
 
+    /**
+     * @brief Per-frame work (auto-save)
+     */
+    void update();
+
     /**
      * @brief Configure components
      */
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief Counts heap allocations made through global operator new
+ *
+ * The replacement operators live in AllocationCounter.cpp and forward to
+ * malloc/free. Counting is per thread, so worker threads (audio loading,
+ * settings writes) do not show up in the main thread's numbers; the
+ * process-wide total is kept as well.
+ */
+class AllocationCounter {
+public:
+    // Allocations made by the calling thread since it started
+    static std::uint64_t getThreadCount();
+
+    // Allocations made by every thread
+    static std::uint64_t getTotalCount();
+};
@@ -0,0 +1,14 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Crash-safe whole-file writes
+ *
+ * Contents go to "<path>.tmp" first and are renamed over the target, so a
+ * reader sees either the old file or the new one - never a partial write.
+ */
+class AtomicFile {
+public:
+    static bool write(const std::string& path, std::string_view contents);
+};
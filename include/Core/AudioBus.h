@@ -0,0 +1,51 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Mixer buses - every voice and music deck plays through exactly one
+enum class AudioBusId {
+    Master,
+    Music,
+    Sfx,
+    Ui,
+    Count
+};
+
+/**
+ * @brief Volume hierarchy master -> music / sfx / ui
+ *
+ * Setting a volume is O(1): it stores the value and bumps a generation counter.
+ * Effective gains (product of the bus and its ancestors) are recomputed lazily
+ * the first time they are read after a change. Consumers remember the generation
+ * they last applied and refresh their sources once per frame when it moved, so a
+ * slider drag firing many changes per second costs constant time per change.
+ */
+class AudioBusGraph {
+public:
+    AudioBusGraph();
+
+    // Volume in percent (0-100), as shown in the settings sliders
+    void setVolume(AudioBusId bus, float volume);
+    float getVolume(AudioBusId bus) const;
+
+    // Linear gain 0..1 including all parent buses
+    float getEffectiveGain(AudioBusId bus) const;
+
+    // Changes whenever any bus volume changes
+    std::uint64_t getGeneration() const { return m_generation; }
+
+private:
+    struct Bus {
+        AudioBusId parent = AudioBusId::Count;   // Count = root
+        float volume = 100.0f;
+        mutable float cachedGain = 1.0f;
+        mutable std::uint64_t cachedGeneration = 0;
+    };
+
+    std::array<Bus, static_cast<std::size_t>(AudioBusId::Count)> m_buses;
+    std::uint64_t m_generation = 1;   // Caches start at 0 - first read computes
+
+    Bus& bus(AudioBusId id) { return m_buses[static_cast<std::size_t>(id)]; }
+    const Bus& bus(AudioBusId id) const { return m_buses[static_cast<std::size_t>(id)]; }
+};
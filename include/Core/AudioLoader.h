@@ -0,0 +1,72 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Decodes sound buffers and opens music streams on worker threads
+ *
+ * Requests are queued from the main thread and picked up by a small pool of
+ * workers (started on the first request). Finished loads wait in a result
+ * queue until the owner collects them - ownership of the decoded buffer or
+ * opened stream moves to the main thread there, so the audio objects in use
+ * are never touched by a worker.
+ */
+class AudioLoader {
+public:
+    enum class Kind {
+        Sound,   // Fully decoded into an sf::SoundBuffer
+        Music    // Opened as an sf::Music stream
+    };
+
+    struct Result {
+        Kind kind = Kind::Sound;
+        std::string name;
+        std::string filePath;
+        std::unique_ptr<sf::SoundBuffer> buffer;  // Kind::Sound, null on failure
+        std::unique_ptr<sf::Music> music;         // Kind::Music, null on failure
+
+        bool succeeded() const { return buffer || music; }
+    };
+
+    explicit AudioLoader(std::size_t workerCount = defaultWorkerCount());
+    ~AudioLoader();
+
+    AudioLoader(const AudioLoader&) = delete;
+    AudioLoader& operator=(const AudioLoader&) = delete;
+
+    void request(Kind kind, const std::string& name, const std::string& filePath);
+
+    // Append finished loads to results - never blocks on a worker that is decoding
+    void collect(std::vector<Result>& results);
+
+    // Requests not yet collected (queued, decoding or finished)
+    std::size_t getPendingCount() const;
+
+    static std::size_t defaultWorkerCount();
+
+private:
+    struct Job {
+        Kind kind = Kind::Sound;
+        std::string name;
+        std::string filePath;
+    };
+
+    void workerLoop(std::stop_token stopToken);
+    static Result load(const Job& job);
+
+    mutable std::mutex m_mutex;
+    std::condition_variable_any m_jobReady;
+    std::deque<Job> m_jobs;
+    std::vector<Result> m_results;
+    std::size_t m_pending = 0;
+
+    std::size_t m_workerCount;
+    std::vector<std::jthread> m_workers;   // Last member - joined before the queues go away
+};
@@ -1,35 +1,110 @@
 #pragma once
 #include <SFML/Audio.hpp>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
+#include <vector>
+#include "MusicPlayer.h"
+#include "AudioBus.h"
+#include "AudioLoader.h"
+
+// Which playing voice gives way when the pool is full
+enum class VoiceStealPolicy {
+    Oldest,         // Voice that started first
+    Quietest,       // Voice with the lowest gain
+    LowestPriority, // Lowest SoundOptions::priority, oldest first on ties - never steals from higher priority
+    None            // Drop the new sound instead
+};
+
+// Per-sound playback rules, fixed at load time
+struct SoundOptions {
+    int priority = 0;               // Higher survives stealing longer
+    unsigned int maxInstances = 4;  // Simultaneous voices of this sound - the oldest one restarts beyond this
+    float gain = 1.0f;              // Base gain relative to its bus (0..1)
+    AudioBusId bus = AudioBusId::Sfx;
+
+    // Positional playback (playSoundAt), in world pixels - needs a mono buffer
+    float minDistance = 150.0f;     // Full volume inside this radius
+    float attenuation = 1.0f;       // Falloff beyond minDistance
+    float maxDistance = 1400.0f;    // Culled (not started / stopped) beyond this
+    bool positional = false;        // Downmixed to mono on load - OpenAL does not spatialize stereo
+};
+
+using SoundId = std::size_t;
+inline constexpr SoundId INVALID_SOUND = std::numeric_limits<SoundId>::max();
+
+// Refers to one playing positional voice - goes stale when the voice ends or is stolen
+struct VoiceHandle {
+    std::uint32_t index = std::numeric_limits<std::uint32_t>::max();
+    std::uint64_t startOrder = 0;
+
+    bool isValid() const { return index != std::numeric_limits<std::uint32_t>::max(); }
+};
 
 class AudioManager {
 public:
     static AudioManager& instance(); // Singleton
 
-    // Volume control
+    // Volume control - O(1), playing sources pick up the change on the next update()
     void setMasterVolume(float volume);
     void setMusicVolume(float volume);
     void setSFXVolume(float volume);
+    void setBusVolume(AudioBusId bus, float volume);
 
     float getMasterVolume() const;
     float getMusicVolume() const;
     float getSFXVolume() const;
+    float getBusVolume(AudioBusId bus) const;
 
-    // Music control
+    // Music control - tracks are pre-opened and crossfaded (see MusicPlayer)
     bool loadMusic(const std::string& name, const std::string& filePath);
-    void playMusic(const std::string& name, bool loop = true);
-    void stopMusic();
+    void playMusic(const std::string& name, bool loop = true, float fadeSeconds = MusicPlayer::DEFAULT_CROSSFADE);
+    void playPlaylist(const std::vector<std::string>& tracks, bool repeat = true, float fadeSeconds = MusicPlayer::DEFAULT_CROSSFADE);
+    void stopMusic(float fadeSeconds = 0.0f);
     void pauseMusic();
     void resumeMusic();
 
-    // Sound effects
-    bool loadSound(const std::string& name, const std::string& filePath);
+    // Register finished background loads, apply pending bus volume changes,
+    // advance music fades and playlists - called every frame
+    void update(float deltaTime);
+
+    // Sound effects - played on a fixed pool of voices so the same sound can overlap
+    bool loadSound(const std::string& name, const std::string& filePath, const SoundOptions& options = {});
+    SoundId getSoundId(const std::string& name) const;
     void playSound(const std::string& name);
+    void playSound(SoundId id, float gain = 1.0f, float pitch = 1.0f); // No lookup, no allocation
+
+    // Positional sound effects in world coordinates, heard relative to the listener.
+    // Sounds beyond SoundOptions::maxDistance are culled instead of taking a voice.
+    VoiceHandle playSoundAt(SoundId id, sf::Vector2f position, float gain = 1.0f, float pitch = 1.0f);
+    void setVoicePosition(VoiceHandle handle, sf::Vector2f position); // Applied in the next update()
+    void stopVoice(VoiceHandle handle);
+    bool isVoicePlaying(VoiceHandle handle) const;
+
+    // Follows the camera - pass the view centre every frame (applied in update())
+    void setListenerPosition(sf::Vector2f position);
+    sf::Vector2f getListenerPosition() const { return m_listenerPosition; }
+
+    // Background loading - returns at once, the file is decoded on a worker thread and
+    // registered by update(). The SoundId is valid immediately; playing it before the
+    // buffer arrives is queued for a moment, then dropped. Music requested while its
+    // track is still opening starts as soon as it is ready.
+    void loadMusicAsync(const std::string& name, const std::string& filePath);
+    SoundId loadSoundAsync(const std::string& name, const std::string& filePath, const SoundOptions& options = {});
+    std::size_t getPendingLoadCount() const { return m_loader.getPendingCount(); }
+
+    // Cooked assets replace the source WAVs: "jump.wav" loads jump.ogg / jump.flac when present
+    static std::string resolveAudioPath(const std::string& filePath);
 
-    void updateMusicVolume();
-    void updateSFXVolume();
+    void setVoiceStealPolicy(VoiceStealPolicy policy) { m_stealPolicy = policy; }
+    VoiceStealPolicy getVoiceStealPolicy() const { return m_stealPolicy; }
+    std::size_t getActiveVoiceCount() const;
 
     void stopAllSounds();
     void resetAudioSystem();
@@ -39,16 +114,85 @@ private:
     AudioManager(const AudioManager&) = delete;
     AudioManager& operator=(const AudioManager&) = delete;
 
-    float getEffectiveVolume(float baseVolume) const;
+    // Push the current bus gains to playing sources (only if a volume changed since last time)
+    void applyBusChanges();
+
+    static constexpr std::size_t MAX_VOICES = 32;
+    static constexpr float MAX_QUEUED_PLAY_DELAY = 0.25f; // seconds - later than this a cue is out of sync
+
+    struct SoundDefinition {
+        const sf::SoundBuffer* buffer = nullptr;  // Null until loaded
+        SoundOptions options;
+        bool loading = false;
+
+        // Last play request made while loading
+        bool playQueued = false;
+        float queuedGain = 1.0f;
+        float queuedPitch = 1.0f;
+        std::chrono::steady_clock::time_point queuedAt;
+    };
+
+    // Track (or playlist) asked for while one of its tracks was still opening
+    struct MusicRequest {
+        std::vector<std::string> tracks;
+        bool loop = true;
+        float fadeSeconds = 0.0f;
+        bool isPlaylist = false;
+        bool active = false;
+    };
+
+    struct Voice {
+        sf::Sound sound;
+        SoundId soundId = INVALID_SOUND;
+        std::uint64_t startOrder = 0;
+        int priority = 0;
+        float gain = 1.0f;
+        AudioBusId bus = AudioBusId::Sfx;
+
+        bool positional = false;
+        bool positionDirty = false;
+        sf::Vector2f position;
+        float maxDistance = 0.0f;
+
+        bool isActive() const { return soundId != INVALID_SOUND && sound.getStatus() != sf::Sound::Stopped; }
+    };
+
+    Voice* acquireVoice(SoundId id, const SoundOptions& options);
+    Voice* chooseVictim(int incomingPriority);
+    Voice* startVoice(SoundId id, float gain, float pitch, bool queueWhileLoading);
+    Voice* resolve(VoiceHandle handle);
+    bool isOutOfRange(sf::Vector2f position, float maxDistance) const;
+
+    // One pass over the voices: move the listener, apply queued positions, cull far sounds
+    void updatePositionalVoices();
+
+    SoundId registerSound(const std::string& name, const SoundOptions& options);
+    void installBuffer(const std::string& name, std::unique_ptr<sf::SoundBuffer> buffer);
+    static void downmixToMono(sf::SoundBuffer& buffer);
+    void processLoadResults();
+    bool isMusicLoading(const std::vector<std::string>& tracks) const;
 
 private:
-    float m_masterVolume;
-    float m_musicVolume;
-    float m_sfxVolume;
+    AudioBusGraph m_buses;
+    std::uint64_t m_appliedBusGeneration = 0;
+
+    MusicPlayer m_musicPlayer;
+
+    std::unordered_map<std::string, std::unique_ptr<sf::SoundBuffer>> m_soundBuffers;   // Buffer addresses stay stable
+    std::unordered_map<std::string, SoundId> m_soundIds;
+    std::vector<SoundDefinition> m_soundDefinitions;                   // Indexed by SoundId
+
+    std::array<Voice, MAX_VOICES> m_voices;
+    std::uint64_t m_nextStartOrder = 0;
+
+    sf::Vector2f m_listenerPosition;
+    bool m_listenerDirty = true;
+    bool m_positionsDirty = false;
+    VoiceStealPolicy m_stealPolicy = VoiceStealPolicy::Oldest;
 
-    std::unordered_map<std::string, std::unique_ptr<sf::Music>> m_music;
-    sf::Music* m_currentMusic = nullptr;
+    std::unordered_set<std::string> m_loadingMusic;
+    MusicRequest m_musicRequest;
+    std::vector<AudioLoader::Result> m_loadResults;   // Reused every update
 
-    std::unordered_map<std::string, sf::SoundBuffer> m_soundBuffers;
-    std::unordered_map<std::string, sf::Sound> m_sounds;
+    AudioLoader m_loader;   // Last member - workers are joined before the buffers above are destroyed
 };
@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include "SettingsRegistry.h"
 
 struct AudioSettings {
     float masterVolume = 100.0f;
@@ -7,10 +8,13 @@ struct AudioSettings {
     float sfxVolume = 100.0f;
     bool menuSoundsEnabled = true;
     float menuSoundVolume = 100.0f;
+
+    bool operator==(const AudioSettings&) const = default;
 };
 
+// Audio view of the settings registry (the audio.* keys of settings.txt)
 class AudioSettingsManager {
 public:
-    static bool save(const AudioSettings& settings, const std::string& filename = "settings.txt");
-    static bool load(AudioSettings& settings, const std::string& filename = "settings.txt");
-};
\ No newline at end of file
+    static AudioSettings read(const SettingsRegistry& registry = SettingsRegistry::instance());
+    static void write(const AudioSettings& settings, SettingsRegistry& registry = SettingsRegistry::instance());
+};
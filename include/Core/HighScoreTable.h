@@ -0,0 +1,59 @@
+#pragma once
+#include "ProfileStore.h"
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Top-N high scores backed by highScore.txt
+ *
+ * The file alternates name and score lines. It is parsed once; entries are
+ * kept sorted (highest first) in a buffer reserved for the capacity, so the
+ * table never allocates after loading. Rank queries and the insertion point
+ * are binary searches; the shift on insert is bounded by the small capacity.
+ * Equal scores keep their order - the earlier one ranks higher.
+ *
+ * Every accepted score is persisted right away with an atomic write
+ * (nothing is written when a score does not make the table) and mirrored
+ * into the profile snapshot.
+ */
+class HighScoreTable {
+public:
+    using Entry = HighScoreRecord;
+
+    static constexpr std::size_t DEFAULT_CAPACITY = 10;
+    static constexpr std::size_t MAX_NAME_LENGTH = 16;
+
+    explicit HighScoreTable(std::size_t capacity = DEFAULT_CAPACITY);
+
+    // Parse the file; malformed pairs are skipped. Returns false if it can't be read.
+    bool load(const std::string& path);
+    bool save() const;
+
+    // Replace all entries (e.g. from the profile snapshot), then persist
+    void assign(const std::vector<Entry>& entries);
+
+    // 1-based rank the score would get, capacity + 1 if it would not make the table
+    std::size_t rankFor(int score) const;
+    bool qualifies(int score) const { return rankFor(score) <= m_capacity; }
+
+    // Insert and persist - returns the rank, or nothing if the score didn't make the table
+    std::optional<std::size_t> submit(const std::string& name, int score);
+
+    const std::vector<Entry>& entries() const { return m_entries; }
+    std::size_t getCapacity() const { return m_capacity; }
+
+    // Rank of the latest accepted submit() - result screens highlight it
+    std::optional<std::size_t> getLastRank() const { return m_lastRank; }
+
+private:
+    std::size_t insertionIndex(int score) const;
+    void insertSorted(Entry entry);
+    std::string serialize() const;
+
+    std::size_t m_capacity;
+    std::vector<Entry> m_entries;
+    std::string m_path = "highScore.txt";
+    std::optional<std::size_t> m_lastRank;
+};
@@ -1,18 +1,21 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include "InputEventBus.h"
 
 /**
  * @brief Interface for all game screens (menu, gameplay, settings, etc.)
  *
  * Each screen handles its own input, logic updates, and rendering.
+ * Input is polled once per frame by the game loop and delivered through the
+ * InputEventBus - screens subscribe to the event types they care about.
  * Follows State Pattern - different screens = different game states.
  */
 class IScreen {
 public:
     virtual ~IScreen() = default;
 
-    // Handle user input (keyboard, mouse, window events)
-    virtual void handleEvents(sf::RenderWindow& window) = 0;
+    // Subscribe input handlers (called once when the screen becomes active)
+    virtual void registerInputHandlers(InputEventBus& bus) = 0;
 
     // Update game logic each frame (animations, movement, etc.)
     virtual void update(float deltaTime) = 0;
@@ -0,0 +1,46 @@
+#pragma once
+#include <SFML/Window.hpp>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief One input event as delivered by the game loop's input stage
+ *
+ * Mouse coordinates in `event` are already mapped to LayoutManager virtual space.
+ */
+struct InputEvent {
+    sf::Event event{};
+    sf::Vector2f position;          // Virtual-space pointer position (mouse events only)
+    std::int64_t timestampUs = 0;   // Poll time of the oldest event merged into this one
+    std::uint64_t sequence = 0;     // Monotonic poll order
+    unsigned int coalescedCount = 1;
+};
+
+/**
+ * @brief Typed dispatch of input events to the active screen
+ *
+ * Handlers subscribe per sf::Event type, so an event only visits handlers
+ * interested in it. Handlers run in subscription order; returning true marks
+ * the event as consumed and stops further delivery.
+ * ScreenManager clears the bus whenever the active screen changes.
+ */
+class InputEventBus {
+public:
+    using Handler = std::function<bool(const InputEvent&)>;
+
+    void subscribe(sf::Event::EventType type, Handler handler);
+
+    // Shortcut for a KeyPressed handler bound to one key (always consumes the key)
+    void subscribeKey(sf::Keyboard::Key key, std::function<void()> action);
+
+    // Returns true if a handler consumed the event
+    bool dispatch(const InputEvent& event) const;
+
+    void clear();
+    bool hasSubscribers(sf::Event::EventType type) const;
+
+private:
+    std::array<std::vector<Handler>, sf::Event::Count> m_handlers;
+};
@@ -0,0 +1,45 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "InputEventBus.h"
+
+class LayoutManager;
+
+/**
+ * @brief Central input stage - drains the window once per frame
+ *
+ * Events are timestamped as they are polled and split into two queues:
+ * system events (close, resize, focus) are handled first, everything else
+ * keeps its arrival order. Redundant motion is coalesced on the way in:
+ * back-to-back MouseMoved events collapse into the latest position and
+ * consecutive wheel scrolls are summed, but nothing is merged across a
+ * click or key press so ordering relative to discrete input is preserved.
+ */
+class InputQueue {
+public:
+    // Drain all pending window events (call once per frame)
+    void poll(sf::RenderWindow& window);
+
+    // Map mouse, wheel and touch coordinates to virtual space (call after the layout view is current)
+    void mapToVirtual(const sf::RenderWindow& window, const LayoutManager& layout);
+
+    const std::vector<InputEvent>& systemEvents() const { return m_systemEvents; }
+    const std::vector<InputEvent>& events() const { return m_events; }
+
+    // Raw events polled vs. events left after coalescing, for the last poll
+    std::size_t getPolledCount() const { return m_polledCount; }
+    std::size_t getQueuedCount() const { return m_systemEvents.size() + m_events.size(); }
+
+    // Monotonic time base used for event timestamps (microseconds)
+    static std::int64_t now();
+
+private:
+    std::vector<InputEvent> m_systemEvents;
+    std::vector<InputEvent> m_events;
+    std::uint64_t m_nextSequence = 0;
+    std::size_t m_polledCount = 0;
+
+    static bool isSystemEvent(sf::Event::EventType type);
+    static bool tryCoalesce(InputEvent& last, const sf::Event& event);
+};
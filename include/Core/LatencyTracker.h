@@ -0,0 +1,96 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "InputEventBus.h"
+
+/**
+ * @brief Fixed-bucket latency histogram (milliseconds)
+ */
+class LatencyHistogram {
+public:
+    // Upper bucket edges in ms - the last bucket collects everything above
+    static constexpr std::array<float, 10> BUCKET_EDGES_MS = { 2, 4, 8, 12, 16, 24, 33, 50, 67, 100 };
+    static constexpr std::size_t BUCKET_COUNT = BUCKET_EDGES_MS.size() + 1;
+
+    void record(std::int64_t latencyUs);
+    void reset();
+
+    std::uint64_t getCount() const { return m_count; }
+    float getMinMs() const;
+    float getMaxMs() const;
+    float getMeanMs() const;
+
+    // Bucket-resolution percentile estimate (upper edge of the bucket holding it)
+    float getPercentileMs(float percentile) const;
+
+    const std::array<std::uint64_t, BUCKET_COUNT>& getBuckets() const { return m_buckets; }
+
+private:
+    std::array<std::uint64_t, BUCKET_COUNT> m_buckets{};
+    std::uint64_t m_count = 0;
+    std::int64_t m_totalUs = 0;
+    std::int64_t m_minUs = 0;
+    std::int64_t m_maxUs = 0;
+};
+
+/**
+ * @brief Input-to-photon latency measurement mode
+ *
+ * While an input event is being dispatched, widgets tag the visible state
+ * changes it causes (tagStateChange). Each tag remembers the poll timestamp of
+ * the input. When the frame containing the change has been handed to the GPU
+ * (right after window.display()) the elapsed time is recorded per source.
+ *
+ * The end point is when display() returns, so any frame-limiter sleep inside
+ * display() is included - numbers are an upper bound on click-to-display time.
+ * Disabled by default; tagging is a single branch when off.
+ */
+class LatencyTracker {
+public:
+    static LatencyTracker& instance(); // Singleton
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return m_enabled; }
+
+    // Game loop hooks
+    void beginDispatch(const InputEvent& input);
+    void endDispatch();
+    void onFramePresented();
+
+    // Widgets call this when input changes something the player will see
+    void tagStateChange(const char* source);
+
+    const LatencyHistogram& getOverall() const { return m_overall; }
+    std::string formatReport() const;
+    bool writeReport(const std::string& path) const;
+    void reset();
+
+private:
+    LatencyTracker();
+    LatencyTracker(const LatencyTracker&) = delete;
+    LatencyTracker& operator=(const LatencyTracker&) = delete;
+
+    struct PendingTag {
+        const char* source;
+        std::int64_t inputTimestampUs;
+    };
+
+    struct SourceStats {
+        std::string name;
+        LatencyHistogram histogram;
+    };
+
+    static constexpr std::size_t MAX_PENDING_TAGS = 64;
+
+    bool m_enabled = false;
+    bool m_dispatching = false;
+    std::int64_t m_currentInputUs = 0;
+
+    std::vector<PendingTag> m_pending;      // Reserved up front - no per-frame allocation
+    std::vector<SourceStats> m_sources;
+    LatencyHistogram m_overall;
+
+    LatencyHistogram& histogramFor(const char* source);
+};
@@ -0,0 +1,73 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+/**
+ * @brief Anchor points on the virtual canvas used for resolution-independent placement
+ */
+enum class Anchor {
+    TopLeft,
+    Top,
+    TopRight,
+    Left,
+    Center,
+    Right,
+    BottomLeft,
+    Bottom,
+    BottomRight
+};
+
+/**
+ * @brief Virtual-resolution layout engine
+ *
+ * All screens lay out and draw in a fixed design space (VIRTUAL_WIDTH x VIRTUAL_HEIGHT).
+ * An sf::View maps that space onto the real window, letterboxing to keep the aspect ratio.
+ * The view is recomputed only when the window size changes and cached otherwise, so
+ * nothing is re-laid out per frame and sprites/shapes are rasterized at the native
+ * window resolution instead of stretching a low-resolution render target.
+ */
+class LayoutManager {
+public:
+    // Design resolution every screen is authored against
+    static constexpr float VIRTUAL_WIDTH = 1400.0f;
+    static constexpr float VIRTUAL_HEIGHT = 800.0f;
+
+    LayoutManager();
+    ~LayoutManager() = default;
+
+    // Recompute the cached view if the window size changed - returns true on change
+    bool updateForWindow(const sf::Vector2u& windowSize);
+
+    // Activate the cached view on a render target
+    void apply(sf::RenderTarget& target) const;
+
+    const sf::View& getView() const { return m_view; }
+    sf::Vector2f getVirtualSize() const { return sf::Vector2f(VIRTUAL_WIDTH, VIRTUAL_HEIGHT); }
+
+    // Uniform scale from virtual units to window pixels
+    float getScale() const { return m_scale; }
+
+    // Bumped on every resize so cached layouts can detect staleness
+    unsigned int getGeneration() const { return m_generation; }
+
+    // Top-left position of a box of 'size' aligned to 'anchor', displaced by 'offset'
+    sf::Vector2f anchor(Anchor anchorPoint, const sf::Vector2f& offset = sf::Vector2f(0.0f, 0.0f),
+        const sf::Vector2f& size = sf::Vector2f(0.0f, 0.0f)) const;
+    sf::FloatRect anchoredRect(Anchor anchorPoint, const sf::Vector2f& offset, const sf::Vector2f& size) const;
+
+    // Window pixel coordinates -> virtual coordinates
+    sf::Vector2f toVirtual(const sf::RenderWindow& window, int x, int y) const;
+
+    // Copy of a mouse, wheel or touch event with its coordinates mapped into virtual space
+    sf::Event toVirtual(const sf::RenderWindow& window, const sf::Event& event) const;
+
+    // Scale a sprite so its texture covers the whole virtual canvas
+    void fitToCanvas(sf::Sprite& sprite) const;
+
+private:
+    sf::View m_view;
+    sf::Vector2u m_windowSize;
+    float m_scale = 1.0f;
+    unsigned int m_generation = 0;
+
+    void recalculateView();
+};
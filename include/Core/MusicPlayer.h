@@ -0,0 +1,71 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Streaming music with crossfades and playlists
+ *
+ * Tracks are opened once at load time (sf::Music keeps the file open and
+ * streams from it), so switching tracks never stalls on a file open.
+ * Two decks are used: the incoming track fades in while the previous one
+ * fades out. Fades advance in update() - nothing blocks or sleeps.
+ *
+ * A single track loops gaplessly through sf::Music's own stream loop.
+ * A playlist starts the next track one crossfade before the current one ends.
+ */
+class MusicPlayer {
+public:
+    static constexpr float DEFAULT_CROSSFADE = 1.5f; // seconds
+
+    bool load(const std::string& name, const std::string& filePath);
+    // Take over a stream opened elsewhere (e.g. by AudioLoader on a worker thread)
+    bool adopt(const std::string& name, std::unique_ptr<sf::Music> music);
+    bool hasTrack(const std::string& name) const;
+
+    // Crossfade to a single track (no-op if it is already the current track)
+    void play(const std::string& name, bool loop = true, float fadeSeconds = DEFAULT_CROSSFADE);
+
+    // Crossfade through several tracks in order
+    void playPlaylist(const std::vector<std::string>& tracks, bool repeat = true, float fadeSeconds = DEFAULT_CROSSFADE);
+
+    void stop(float fadeSeconds = 0.0f);
+    void pause();
+    void resume();
+
+    // Advance fades and the playlist - call once per frame
+    void update(float deltaTime);
+
+    // Bus volume (0-100) - each deck plays at volume * its fade gain
+    void setVolume(float volume);
+
+    const std::string& getCurrentTrack() const { return m_current.name; }
+
+private:
+    struct Deck {
+        sf::Music* music = nullptr;
+        std::string name;
+        float gain = 0.0f;       // Fade position 0..1
+        float fadeRate = 0.0f;   // Gain change per second (+ fading in, - fading out)
+    };
+
+    std::unordered_map<std::string, std::unique_ptr<sf::Music>> m_tracks;
+    Deck m_current;
+    Deck m_outgoing;
+    float m_volume = 100.0f;
+    bool m_paused = false;
+
+    std::vector<std::string> m_playlist;
+    std::size_t m_playlistIndex = 0;
+    bool m_repeatPlaylist = true;
+    float m_crossfade = DEFAULT_CROSSFADE;
+
+    void startTrack(const std::string& name, bool loop, float fadeSeconds);
+    void fadeOutCurrent(float fadeSeconds);
+    void advancePlaylist();
+    bool advanceFade(Deck& deck, float deltaTime);
+    void applyVolume(Deck& deck);
+    static float rateFor(float fadeSeconds);
+};
@@ -0,0 +1,72 @@
+#pragma once
+#include "SettingsRegistry.h"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct HighScoreRecord {
+    std::string name;
+    std::int32_t score = 0;
+};
+
+// Everything the player owns, in one snapshot
+struct ProfileData {
+    std::optional<SettingsRegistry::Values> settings;   // Empty until captured
+    std::vector<HighScoreRecord> highScores;
+    std::vector<std::string> unlocks;
+};
+
+/**
+ * @brief Binary, versioned profile snapshot (profile.dat)
+ *
+ * Layout (little endian):
+ *   header   "DBPF" | u16 version | u16 section count | u32 payload size | u32 CRC-32 of payload
+ *   sections u32 tag | u32 size | data   - SETT settings, SCOR high scores, UNLK unlocks
+ *
+ * The file is memory mapped and validated (magic, version, size, checksum)
+ * before anything is decoded. Writes go to a temp file; the previous good
+ * snapshot is kept as profile.dat.bak. A truncated or corrupt profile.dat
+ * is detected on load and rolled back to the backup instead of silently
+ * resetting the player's data. Unknown sections are skipped, so later
+ * versions can add sections without breaking older readers of the same version.
+ */
+class ProfileStore {
+public:
+    enum class LoadResult {
+        Loaded,       // profile.dat is valid
+        RolledBack,   // profile.dat was damaged - the backup was restored
+        Missing,      // No profile yet
+        Corrupt       // Neither file is usable - data keeps its defaults
+    };
+
+    static ProfileStore& instance(); // Singleton
+
+    LoadResult load();
+    bool save();
+
+    ProfileData& data() { return m_data; }
+    const ProfileData& data() const { return m_data; }
+
+    // Settings travel in the snapshot as a fallback for a lost settings.txt
+    void captureSettings();
+    bool restoreSettings() const;
+
+    bool isUnlocked(std::string_view id) const;
+    void unlock(std::string_view id);
+
+    static constexpr std::uint16_t FORMAT_VERSION = 1;
+
+private:
+    ProfileStore() = default;
+    ProfileStore(const ProfileStore&) = delete;
+    ProfileStore& operator=(const ProfileStore&) = delete;
+
+    static std::vector<std::uint8_t> encode(const ProfileData& data);
+    static std::optional<ProfileData> decode(const std::uint8_t* bytes, std::size_t size);
+    static std::optional<ProfileData> readFile(const std::string& path);
+
+    std::string m_path = "profile.dat";
+    ProfileData m_data;
+};
@@ -2,10 +2,12 @@
 
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <functional>
 #include "ScreenTypes.h"
 #include "IScreen.h"
+#include "InputEventBus.h"
 
 // Manages screen transitions and lifecycle
 class ScreenManager {
@@ -16,11 +18,16 @@ public:
     // Register a screen factory function for a given screen type
     void registerScreen(ScreenType type, std::function<std::unique_ptr<IScreen>()> creator);
 
-    // Change to a different screen
+    // Request a different screen - applied by applyPendingScreenChange() so a
+    // screen is never destroyed while one of its own handlers is running
     void changeScreen(ScreenType type);
 
-    // Handle SFML events for the current screen
-    void handleEvents(sf::RenderWindow& window);
+    // Swap in the requested screen (if any) and rebind its input handlers
+    void applyPendingScreenChange();
+    bool hasPendingScreenChange() const { return m_pendingScreen.has_value(); }
+
+    // Deliver one input event to the current screen through the event bus
+    void dispatchInput(const InputEvent& input);
 
     // Update the current screen
     void update(float deltaTime);
@@ -28,10 +35,24 @@ public:
     // Render the current screen
     void render(sf::RenderWindow& window);
 
+    // Called after a new screen became active (e.g. to switch music)
+    void setOnScreenChanged(std::function<void(ScreenType)> callback) { m_onScreenChanged = std::move(callback); }
+    ScreenType getCurrentScreenType() const { return m_currentType; }
+
+    // Screens ask the game loop to close the window through here
+    void requestQuit() { m_quitRequested = true; }
+    bool isQuitRequested() const { return m_quitRequested; }
+
     // Get the current screen (optional, for debugging)
     IScreen* getCurrentScreen() const { return m_currentScreen.get(); }
+    InputEventBus& inputBus() { return m_inputBus; }
 
 private:
     std::unordered_map<ScreenType, std::function<std::unique_ptr<IScreen>()>> m_creators;
     std::unique_ptr<IScreen> m_currentScreen;
-};
\ No newline at end of file
+    std::optional<ScreenType> m_pendingScreen;
+    ScreenType m_currentType = ScreenType::LOADING;
+    std::function<void(ScreenType)> m_onScreenChanged;
+    InputEventBus m_inputBus;
+    bool m_quitRequested = false;
+};
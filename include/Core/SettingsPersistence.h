@@ -0,0 +1,58 @@
+#pragma once
+#include "AudioSettingsManager.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Debounced background writer for settings.txt
+ *
+ * submit() only records the latest settings - a burst of changes (a slider
+ * drag) coalesces into a single write once no new change has arrived for the
+ * debounce delay. The write happens on a background thread, is skipped when
+ * the values match what is already on disk, and goes through a temp file +
+ * rename so a crash mid-write never leaves a truncated file.
+ */
+class SettingsPersistence {
+public:
+    static SettingsPersistence& instance(); // Singleton
+
+    // Load settings.txt into the registry and remember it as the on-disk state
+    bool load(AudioSettings& settings);
+
+    // Schedule a write of the registry after the debounce delay (main thread)
+    void submit();
+    void submit(const AudioSettings& settings); // Stores the audio fields first
+
+    // Write anything pending now, on the calling thread (app exit)
+    void flush();
+
+    void setDebounceDelay(float seconds);
+    float getDebounceDelay() const;
+    bool hasPendingWrite() const;
+
+private:
+    SettingsPersistence() = default;
+    ~SettingsPersistence();
+    SettingsPersistence(const SettingsPersistence&) = delete;
+    SettingsPersistence& operator=(const SettingsPersistence&) = delete;
+
+    void workerLoop(std::stop_token stopToken);
+    void writeIfChanged(const SettingsRegistry::Values& values); // Caller holds m_writeMutex
+
+    std::string m_filename = "settings.txt";
+
+    mutable std::mutex m_mutex;
+    std::condition_variable_any m_changed;
+    std::optional<SettingsRegistry::Values> m_pending;   // Snapshot - the worker never reads the registry
+    std::chrono::steady_clock::time_point m_deadline;
+    std::chrono::duration<float> m_delay{ 0.5f };
+
+    std::mutex m_writeMutex;                  // Taken before m_mutex - snapshot and write are one step
+    std::optional<SettingsRegistry::Values> m_persisted; // What settings.txt holds, once known
+
+    std::jthread m_worker;   // Last member - joined before the state above goes away
+};
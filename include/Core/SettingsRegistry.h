@@ -0,0 +1,84 @@
+#pragma once
+#include "SettingsSchema.h"
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Typed settings store driven by SETTINGS_SCHEMA
+ *
+ * Values are kept in declared types and clamped to their declared range.
+ * settings.txt is parsed in a single pass over the file contents; keys are
+ * dispatched through a perfect hash built from the schema at startup (no
+ * if-else chain, one string compare per line). Files written by older
+ * versions are migrated through SETTING_RENAMES while parsing.
+ *
+ * Listeners subscribe per setting and are called after its value changed,
+ * whether by set() or by a load. Main thread only - the background writer
+ * works on copies of values().
+ */
+class SettingsRegistry {
+public:
+    using Values = std::array<SettingValue, SETTING_COUNT>;
+    using Listener = std::function<void(SettingId)>;
+    using ListenerId = std::size_t;
+
+    static SettingsRegistry& instance(); // Singleton
+
+    const SettingValue& get(SettingId id) const { return m_values[index(id)]; }
+    bool getBool(SettingId id) const { return std::get<bool>(get(id)); }
+    int getInt(SettingId id) const { return std::get<int>(get(id)); }
+    float getFloat(SettingId id) const { return std::get<float>(get(id)); }
+
+    // Converted to the declared type and clamped. Returns true (and notifies) if the value changed.
+    bool set(SettingId id, SettingValue value);
+    void resetToDefaults();
+
+    const Values& values() const { return m_values; }
+    static const SettingDescriptor& describe(SettingId id) { return SETTINGS_SCHEMA[index(id)]; }
+
+    ListenerId subscribe(SettingId id, Listener listener);
+    void unsubscribe(ListenerId listenerId);
+
+    // Keys missing from the file keep their current value. Returns false if the file can't be read.
+    bool loadFromFile(const std::string& filename);
+    std::size_t parse(std::string_view text);   // Returns the number of settings applied
+    int getLoadedVersion() const { return m_loadedVersion; }
+
+    static std::string serialize(const Values& values);
+
+    std::optional<SettingId> findKey(std::string_view key) const;
+
+private:
+    SettingsRegistry();
+    SettingsRegistry(const SettingsRegistry&) = delete;
+    SettingsRegistry& operator=(const SettingsRegistry&) = delete;
+
+    static constexpr std::size_t index(SettingId id) { return static_cast<std::size_t>(id); }
+    static std::uint32_t hashKey(std::string_view key, std::uint32_t seed);
+    static SettingValue normalize(const SettingDescriptor& descriptor, SettingValue value);
+    static std::optional<SettingValue> parseValue(SettingType type, std::string_view text);
+
+    void buildKeyTable();
+    std::optional<SettingId> findLegacyKey(std::string_view key, int fileVersion) const;
+    void notify(SettingId id);
+
+    Values m_values;
+    int m_loadedVersion = SETTINGS_VERSION;
+
+    // Perfect hash: every schema key lands in its own slot for m_hashSeed
+    std::vector<std::size_t> m_keySlots;   // Setting index, SETTING_COUNT = empty
+    std::uint32_t m_hashSeed = 0;
+    std::uint32_t m_slotMask = 0;
+
+    struct Subscription {
+        ListenerId id;
+        SettingId setting;
+        Listener callback;
+    };
+    std::vector<Subscription> m_listeners;
+    ListenerId m_nextListenerId = 1;
+};
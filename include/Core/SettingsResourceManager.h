@@ -2,6 +2,7 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <string>
+#include "LayoutManager.h"
 
 /**
  * @brief Handles resource loading for Settings Screen
@@ -44,9 +45,9 @@ private:
     void setupFallbackBackground();
     void scaleBackgroundToWindow();
 
-    // Constants for maintainability
-    static constexpr unsigned int WINDOW_WIDTH = 1400;
-    static constexpr unsigned int WINDOW_HEIGHT = 800;
+    // Constants for maintainability - canvas size comes from LayoutManager
+    static constexpr unsigned int WINDOW_WIDTH = static_cast<unsigned int>(LayoutManager::VIRTUAL_WIDTH);
+    static constexpr unsigned int WINDOW_HEIGHT = static_cast<unsigned int>(LayoutManager::VIRTUAL_HEIGHT);
     static constexpr const char* FONT_PATH = "arial.ttf";
     static constexpr const char* BACKGROUND_PATH = "SettingsScreen.png";
 };
\ No newline at end of file
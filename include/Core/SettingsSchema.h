@@ -0,0 +1,86 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <variant>
+
+/**
+ * @brief Declaration of every persisted setting
+ *
+ * Adding a setting: add its id to SettingId and its row to SETTINGS_SCHEMA
+ * (same order). Renamed keys go into SETTING_RENAMES together with a bump of
+ * SETTINGS_VERSION so older files still load.
+ */
+
+enum class SettingType {
+    Bool,
+    Int,
+    Float
+};
+
+using SettingValue = std::variant<bool, int, float>;
+
+enum class SettingId : std::size_t {
+    // Audio
+    MasterVolume,
+    MusicVolume,
+    SfxVolume,
+    MenuSoundsEnabled,
+    MenuSoundVolume,
+
+    // Video
+    VerticalSync,
+    FramerateLimit,
+
+    Count
+};
+
+inline constexpr std::size_t SETTING_COUNT = static_cast<std::size_t>(SettingId::Count);
+
+struct SettingDescriptor {
+    SettingId id;
+    std::string_view key;          // "section.name" in settings.txt
+    SettingType type;
+    SettingValue defaultValue;
+    float minValue = 0.0f;         // Inclusive range for Int / Float
+    float maxValue = 0.0f;
+};
+
+// Version 0: flat audio keys without a version line. Version 1: sectioned keys.
+inline constexpr int SETTINGS_VERSION = 1;
+
+inline constexpr std::array<SettingDescriptor, SETTING_COUNT> SETTINGS_SCHEMA = { {
+    { SettingId::MasterVolume,      "audio.master_volume",       SettingType::Float, 100.0f, 0.0f, 100.0f },
+    { SettingId::MusicVolume,       "audio.music_volume",        SettingType::Float, 100.0f, 0.0f, 100.0f },
+    { SettingId::SfxVolume,         "audio.sfx_volume",          SettingType::Float, 100.0f, 0.0f, 100.0f },
+    { SettingId::MenuSoundsEnabled, "audio.menu_sounds_enabled", SettingType::Bool,  true },
+    { SettingId::MenuSoundVolume,   "audio.menu_sound_volume",   SettingType::Float, 100.0f, 0.0f, 100.0f },
+
+    { SettingId::VerticalSync,      "video.vsync",               SettingType::Bool,  false },
+    { SettingId::FramerateLimit,    "video.framerate_limit",     SettingType::Int,   60, 0.0f, 240.0f }, // 0 = unlimited
+} };
+
+struct SettingRename {
+    int beforeVersion;             // Applies to files older than this
+    std::string_view oldKey;
+    SettingId id;
+};
+
+inline constexpr std::array<SettingRename, 5> SETTING_RENAMES = { {
+    { 1, "master_volume",       SettingId::MasterVolume },
+    { 1, "music_volume",        SettingId::MusicVolume },
+    { 1, "sfx_volume",          SettingId::SfxVolume },
+    { 1, "menu_sounds_enabled", SettingId::MenuSoundsEnabled },
+    { 1, "menu_sound_volume",   SettingId::MenuSoundVolume },
+} };
+
+constexpr bool isSchemaInIdOrder() {
+    for (std::size_t i = 0; i < SETTINGS_SCHEMA.size(); ++i) {
+        if (static_cast<std::size_t>(SETTINGS_SCHEMA[i].id) != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(isSchemaInIdOrder(), "SETTINGS_SCHEMA rows must follow SettingId order");
@@ -22,6 +22,7 @@ public:
         std::string titleFont;
     };
 
+    // Positions are in LayoutManager virtual coordinates (resolution independent)
     struct Layout {
         float startY;
         float spacing;
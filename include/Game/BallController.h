@@ -0,0 +1,26 @@
+#pragma once
+#include "World.h"
+
+struct BallInput {
+    float moveAxis = 0.0f;    // -1 left .. +1 right
+    bool jumpRequested = false;
+};
+
+/**
+ * @brief Turns player input into ball velocity (acceleration, friction, gravity, jump)
+ *
+ * Gift modifiers on the ball change the handling: speed stacks raise
+ * acceleration and top speed, reverse movement swaps left and right and a
+ * headwind keeps pushing the ball back.
+ */
+class BallController {
+public:
+    static constexpr float ACCELERATION = 1800.0f;  // px/s^2
+    static constexpr float FRICTION = 1400.0f;      // px/s^2 when no input
+    static constexpr float MAX_SPEED = 420.0f;      // px/s
+    static constexpr float JUMP_SPEED = 760.0f;     // px/s
+    static constexpr float GRAVITY = 1900.0f;       // px/s^2
+    static constexpr float MAX_FALL_SPEED = 1400.0f;
+
+    void update(World& world, Entity ball, const BallInput& input, float deltaTime);
+};
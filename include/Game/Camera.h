@@ -0,0 +1,54 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "World.h"
+#include "SpatialHash.h"
+
+/**
+ * @brief 2D camera for the PLAY screen - smooth follow, dead zone and look-ahead
+ *
+ * The target can move freely inside a dead zone around the camera's focus
+ * without the view moving, so small hops don't shake the screen. Once it
+ * leaves the zone the focus is dragged along, shifted ahead in the direction
+ * of travel, and the view eases towards it. The view never shows past the
+ * level bounds; an axis where the level is smaller than the view is centred.
+ *
+ * collectVisible() asks the spatial index for what the view overlaps, so
+ * drawing costs follow what is on screen, not the size of the level.
+ */
+class Camera {
+public:
+    static constexpr float DEAD_ZONE_WIDTH = 180.0f;    // px
+    static constexpr float DEAD_ZONE_HEIGHT = 140.0f;
+    static constexpr float LOOK_AHEAD = 240.0f;         // px ahead at LOOK_AHEAD_SPEED
+    static constexpr float LOOK_AHEAD_SPEED = 420.0f;   // px/s for the full look-ahead
+    static constexpr float LOOK_AHEAD_RATE = 2.0f;      // 1/s - how fast the look-ahead swings round
+    static constexpr float FOLLOW_RATE = 6.0f;          // 1/s - how fast the view catches up
+    static constexpr float CULL_MARGIN = 64.0f;         // px beyond the view still collected
+
+    void setViewSize(sf::Vector2f size);
+    void setBounds(const sf::FloatRect& bounds);
+
+    // Centre on the target at once (level start, respawn)
+    void snapTo(sf::Vector2f target);
+    void follow(sf::Vector2f target, sf::Vector2f velocity, float deltaTime);
+
+    const sf::View& getView() const { return m_view; }
+    sf::Vector2f getCenter() const { return m_center; }
+    sf::FloatRect getVisibleArea() const;
+
+    // Entities whose collider may be on screen: the spatial index plus the (few) circle colliders
+    void collectVisible(World& world, const SpatialHash& index, std::vector<Entity>& results) const;
+
+private:
+    sf::View m_view;
+    sf::Vector2f m_size;
+    sf::Vector2f m_center;
+    sf::Vector2f m_focus;
+    float m_lookAhead = 0.0f;
+    sf::FloatRect m_bounds;
+    bool m_hasBounds = false;
+
+    sf::Vector2f clampToBounds(sf::Vector2f center) const;
+    void applyView();
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <optional>
+
+// First contact of a moving circle with a box
+struct SweepHit {
+    float time = 0.0f;      // Fraction of the displacement travelled before contact (0..1)
+    sf::Vector2f normal;    // Surface normal at the contact, pointing towards the circle
+};
+
+/**
+ * @brief Circle vs axis-aligned box tests used by the ball physics
+ *
+ * The sweep treats the circle as a ray against the box grown by the radius
+ * (a rounded rectangle), so fast balls hit thin geometry they would jump
+ * over with per-frame overlap tests.
+ */
+namespace Collision {
+    // Circle moving by `delta` from `start` - no hit if it starts overlapping or never touches
+    std::optional<SweepHit> sweepCircle(sf::Vector2f start, sf::Vector2f delta, float radius, const sf::FloatRect& box);
+
+    // Minimum translation that moves an overlapping circle out of the box, or nullopt if apart
+    std::optional<sf::Vector2f> penetration(sf::Vector2f center, float radius, const sf::FloatRect& box);
+
+    bool overlaps(sf::Vector2f center, float radius, const sf::FloatRect& box);
+
+    // Bounds of a circle over its whole sweep
+    sf::FloatRect sweptBounds(sf::Vector2f start, sf::Vector2f delta, float radius);
+}
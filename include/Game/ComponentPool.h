@@ -0,0 +1,98 @@
+#pragma once
+#include "Entity.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+class IComponentPool {
+public:
+    virtual ~IComponentPool() = default;
+    virtual void removeIndex(std::uint32_t entityIndex) = 0;
+    virtual void clear() = 0;
+};
+
+/**
+ * @brief Dense storage for one component type (sparse set)
+ *
+ * Components sit contiguously in m_dense with the owning entity at the same
+ * position in m_entities; m_sparse maps an entity index to that position.
+ * Systems iterate components() / entities() linearly. Removal swaps the last
+ * element into the hole, so the arrays stay dense - order is not preserved.
+ */
+template <typename T>
+class ComponentPool final : public IComponentPool {
+public:
+    static constexpr std::uint32_t NONE = std::numeric_limits<std::uint32_t>::max();
+
+    T& add(Entity entity, T component) {
+        if (entity.index >= m_sparse.size()) {
+            m_sparse.resize(static_cast<std::size_t>(entity.index) + 1, NONE);
+        }
+
+        std::uint32_t& slot = m_sparse[entity.index];
+        if (slot != NONE) {
+            m_dense[slot] = std::move(component);
+            m_entities[slot] = entity;
+            return m_dense[slot];
+        }
+
+        slot = static_cast<std::uint32_t>(m_dense.size());
+        m_dense.push_back(std::move(component));
+        m_entities.push_back(entity);
+        return m_dense.back();
+    }
+
+    bool has(std::uint32_t entityIndex) const {
+        return entityIndex < m_sparse.size() && m_sparse[entityIndex] != NONE;
+    }
+
+    T* tryGet(std::uint32_t entityIndex) {
+        return has(entityIndex) ? &m_dense[m_sparse[entityIndex]] : nullptr;
+    }
+
+    const T* tryGet(std::uint32_t entityIndex) const {
+        return has(entityIndex) ? &m_dense[m_sparse[entityIndex]] : nullptr;
+    }
+
+    void removeIndex(std::uint32_t entityIndex) override {
+        if (!has(entityIndex)) {
+            return;
+        }
+
+        std::uint32_t slot = m_sparse[entityIndex];
+        std::uint32_t last = static_cast<std::uint32_t>(m_dense.size() - 1);
+        if (slot != last) {
+            m_dense[slot] = std::move(m_dense[last]);
+            m_entities[slot] = m_entities[last];
+            m_sparse[m_entities[slot].index] = slot;
+        }
+
+        m_dense.pop_back();
+        m_entities.pop_back();
+        m_sparse[entityIndex] = NONE;
+    }
+
+    void clear() override {
+        m_dense.clear();
+        m_entities.clear();
+        m_sparse.clear();
+    }
+
+    void reserve(std::size_t count) {
+        m_dense.reserve(count);
+        m_entities.reserve(count);
+    }
+
+    std::span<T> components() { return m_dense; }
+    std::span<const T> components() const { return m_dense; }
+    std::span<const Entity> entities() const { return m_entities; }
+    std::size_t size() const { return m_dense.size(); }
+
+private:
+    std::vector<T> m_dense;
+    std::vector<Entity> m_entities;
+    std::vector<std::uint32_t> m_sparse;
+};
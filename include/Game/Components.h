@@ -0,0 +1,137 @@
+#pragma once
+#include <SFML/System.hpp>
+#include <array>
+#include <cstdint>
+#include "GameTextures.h"
+#include "TimerWheel.h"
+
+/**
+ * @brief Plain-data components of the gameplay ECS
+ *
+ * Each type gets its own dense pool in World, so a system touching only
+ * positions and velocities streams through just those two arrays.
+ * Positions are entity centres in world pixels (y grows downwards).
+ */
+
+enum class EntityKind : std::uint8_t {
+    Ball,
+    Coin,
+    RareCoin,
+    Cactus,
+    Box,
+    Gift,
+    FalconEnemy,
+    SquareEnemy
+};
+
+enum class BallType : std::uint8_t {
+    Normal,
+    Magnetic,
+    Transparent,
+    Protected
+};
+
+enum class GiftType : std::uint8_t {
+    Speed,
+    ReverseMovement,
+    HeadwindStorm,
+    LifeHeart,
+    ProtectiveShield
+};
+
+enum class EnemyState : std::uint8_t {
+    Patrol,     // Square: walks back and forth around its home
+    Hover,      // Falcon: circles above its home, watching for the ball
+    Swoop,      // Falcon: dives at where the ball was
+    Return      // Falcon: climbs back home
+};
+
+// Timed effects a ball can carry - several of the same type stack
+enum class ModifierType : std::uint8_t {
+    Speed,
+    ReverseMovement,
+    Headwind,
+    Shield,
+    Magnetic,
+    Count
+};
+
+struct Position {
+    sf::Vector2f value;
+};
+
+struct Velocity {
+    sf::Vector2f value;
+};
+
+// Drawn as a textured quad of `size` centred on the position
+struct SpriteComponent {
+    TextureId texture = TextureId::Coin;
+    sf::Vector2f size;
+};
+
+// Axis-aligned box around the position - solid boxes stop balls, the rest only report contacts
+struct BoxCollider {
+    sf::Vector2f halfSize;
+    bool solid = false;
+};
+
+// Balls collide as circles and are moved by PhysicsSystem, not MovementSystem
+struct CircleCollider {
+    float radius = 0.0f;
+};
+
+struct Kind {
+    EntityKind value = EntityKind::Coin;
+};
+
+struct Ball {
+    BallType type = BallType::Normal;
+    bool grounded = false;
+    int lives = 3;
+    int score = 0;
+};
+
+// Active timed modifiers of one entity, each expiring through its own wheel timer
+struct Modifiers {
+    static constexpr std::size_t CAPACITY = 8;
+
+    struct Entry {
+        ModifierType type = ModifierType::Speed;
+        TimerId timer;
+    };
+
+    std::array<Entry, CAPACITY> entries{};
+    std::uint8_t count = 0;
+    std::array<std::uint8_t, static_cast<std::size_t>(ModifierType::Count)> stacks{};
+
+    std::uint8_t stacksOf(ModifierType type) const { return stacks[static_cast<std::size_t>(type)]; }
+};
+
+struct CoinValue {
+    int value = 1;
+};
+
+// Driven by EnemyAISystem - distant enemies are ticked less often (see `period`)
+struct EnemyAI {
+    sf::Vector2f home;
+    EnemyState state = EnemyState::Patrol;
+    float direction = 1.0f;       // Patrol heading, +1 right
+    float stateTime = 0.0f;       // Seconds in the current state
+    sf::Vector2f swoopTarget;
+    double lastTick = 0.0;        // System time of the previous tick
+    std::uint8_t period = 0;      // Frames between ticks, 0 until first classified
+};
+
+struct Gift {
+    GiftType type = GiftType::Speed;
+};
+
+// Placed by the level file - destroyed when its column is streamed out
+struct LevelObject {
+    std::uint32_t spawnId = 0;
+    int column = 0;
+};
+
+// Box that has already handed out its power-up
+struct Opened {};
@@ -0,0 +1,51 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "GameTextures.h"
+#include "ObjectPool.h"
+
+enum class EffectType : std::uint8_t {
+    CoinPickup,     // Collected coin floats up and shrinks away
+    BoxOpened,      // The power-up rises out of the box
+    EnemyKilled,    // Enemy puffs up and fades
+    Count
+};
+
+/**
+ * @brief Short-lived feedback sprites (pickups, box openings, kills)
+ *
+ * Effects are spawned and expire constantly, so they are not entities:
+ * they come from an ObjectPool sized up front and are drawn like sprites,
+ * one vertex array per texture. In steady play nothing here allocates.
+ */
+class EffectSystem {
+public:
+    static constexpr std::size_t INITIAL_CAPACITY = 128;
+
+    explicit EffectSystem(const GameTextures& textures);
+    ~EffectSystem();
+
+    void spawn(EffectType type, TextureId texture, sf::Vector2f position, sf::Vector2f size);
+    void update(float deltaTime);
+    void render(sf::RenderTarget& target);
+    void clear();
+
+    std::size_t getActiveCount() const { return m_active.size(); }
+
+private:
+    struct Effect {
+        EffectType type = EffectType::CoinPickup;
+        TextureId texture = TextureId::Coin;
+        sf::Vector2f position;
+        sf::Vector2f size;
+        float age = 0.0f;
+    };
+
+    const GameTextures& m_textures;
+    ObjectPool<Effect> m_pool;
+    std::vector<Effect*> m_active;
+    std::array<sf::VertexArray, TEXTURE_COUNT> m_batches;
+};
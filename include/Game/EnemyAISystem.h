@@ -0,0 +1,76 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "World.h"
+#include "Components.h"
+#include "TileMap.h"
+
+/**
+ * @brief Enemy behaviours with level-of-detail scheduling
+ *
+ * Squares patrol around their spawn point, turning at walls, ledges and the
+ * end of their range. Falcons hover above theirs and swoop at the ball when
+ * it passes below, then climb back.
+ *
+ * Enemies are not all updated every frame. Each one sits in a ring of
+ * per-frame buckets and, once ticked, is re-queued a number of frames ahead
+ * that depends on its distance to the view: every frame on screen, every
+ * NEAR_PERIOD frames close by, every FAR_PERIOD frames further out. A tick
+ * integrates all the time since the enemy's previous one. Enemies that change
+ * level are offset by their entity index, so the distant ones spread evenly
+ * over the frames instead of all landing on the same one - per-frame cost
+ * stays flat however large the level gets.
+ */
+class EnemyAISystem {
+public:
+    static constexpr int NEAR_PERIOD = 4;
+    static constexpr int FAR_PERIOD = 16;
+    static constexpr float ACTIVE_MARGIN = 128.0f;   // px around the view still updated every frame
+    static constexpr float NEAR_MARGIN = 960.0f;     // px around the view counted as near
+    static constexpr float MAX_TICK = 0.5f;          // Longest step a single tick integrates, seconds
+
+    // Square
+    static constexpr float PATROL_SPEED = 110.0f;    // px/s
+    static constexpr float PATROL_RANGE = 192.0f;    // px either side of home
+
+    // Falcon
+    static constexpr float HOVER_RADIUS = 36.0f;
+    static constexpr float HOVER_RATE = 1.6f;        // rad/s
+    static constexpr float SWOOP_REACH_X = 320.0f;   // Ball must be this close horizontally ...
+    static constexpr float SWOOP_REACH_Y = 520.0f;   // ... and below by at most this much
+    static constexpr float SWOOP_SPEED = 620.0f;
+    static constexpr float SWOOP_TIMEOUT = 1.5f;
+    static constexpr float RETURN_SPEED = 240.0f;
+    static constexpr float SWOOP_COOLDOWN = 2.0f;    // Hover time before the next swoop
+
+    EnemyAISystem();
+
+    void add(World& world, Entity enemy);
+    void update(World& world, const TileMap& map, const sf::FloatRect& view, Entity target, float deltaTime);
+    void clear();
+
+    // Falcons that started a swoop during the last update
+    const std::vector<Entity>& getSwoopsStarted() const { return m_swoopsStarted; }
+
+    std::size_t getTrackedCount() const { return m_trackedCount; }
+    std::size_t getTickedCount() const { return m_tickedCount; }
+
+private:
+    static constexpr std::size_t RING_SIZE = FAR_PERIOD;
+
+    std::array<std::vector<Entity>, RING_SIZE> m_ring;
+    std::vector<Entity> m_due;
+    std::vector<Entity> m_swoopsStarted;
+    std::uint64_t m_frame = 0;
+    double m_time = 0.0;
+    std::size_t m_trackedCount = 0;
+    std::size_t m_tickedCount = 0;
+
+    void schedule(Entity enemy, std::uint64_t frame);
+    static int periodFor(sf::Vector2f position, const sf::FloatRect& view);
+    void patrol(EnemyAI& ai, sf::Vector2f& position, sf::Vector2f size, const TileMap& map, float deltaTime);
+    void fly(Entity falcon, EnemyAI& ai, sf::Vector2f& position, const sf::Vector2f* target, bool onScreen, float deltaTime);
+};
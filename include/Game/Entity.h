@@ -0,0 +1,20 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Generational handle to a gameplay entity
+ *
+ * The index addresses the component pools; the generation changes every time
+ * the index is recycled, so a handle kept past its entity's destruction
+ * simply stops resolving instead of aliasing a new entity.
+ */
+struct Entity {
+    static constexpr std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t index = INVALID_INDEX;
+    std::uint32_t generation = 0;
+
+    bool isValid() const { return index != INVALID_INDEX; }
+    bool operator==(const Entity&) const = default;
+};
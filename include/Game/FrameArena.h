@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Bump allocator for scratch data that only lives for one frame
+ *
+ * allocate() hands out slices of one fixed buffer and reset() at the start
+ * of the next frame takes them all back at once - no frees, no heap traffic.
+ * Only trivially destructible types are allowed since nothing is destroyed.
+ * Requests that do not fit fall back to the heap until the next reset and
+ * are counted, so the capacity can be tuned from getPeakUsage().
+ */
+class FrameArena {
+public:
+    // Enough for AVX loads on every slice
+    static constexpr std::size_t ALIGNMENT = 32;
+
+    explicit FrameArena(std::size_t capacity);
+
+    template <typename T>
+    std::span<T> allocate(std::size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "FrameArena never runs destructors");
+        static_assert(alignof(T) <= ALIGNMENT);
+
+        void* memory = allocateBytes(count * sizeof(T));
+        T* first = static_cast<T*>(memory);
+        for (std::size_t i = 0; i < count; ++i) {
+            new (first + i) T();
+        }
+        return std::span<T>(first, count);
+    }
+
+    void reset();
+
+    std::size_t getCapacity() const { return m_capacity; }
+    std::size_t getUsage() const { return m_offset; }
+    std::size_t getPeakUsage() const { return m_peak; }
+    std::size_t getOverflowCount() const { return m_overflowCount; }
+
+private:
+    struct AlignedDelete {
+        void operator()(std::byte* memory) const {
+            ::operator delete[](memory, std::align_val_t(ALIGNMENT));
+        }
+    };
+    using Buffer = std::unique_ptr<std::byte[], AlignedDelete>;
+
+    static Buffer allocateBuffer(std::size_t size);
+    void* allocateBytes(std::size_t size);
+
+    Buffer m_buffer;
+    std::size_t m_capacity;
+    std::size_t m_offset = 0;
+    std::size_t m_peak = 0;
+    std::size_t m_overflowCount = 0;
+    std::vector<Buffer> m_overflow;
+};
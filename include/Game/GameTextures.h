@@ -0,0 +1,46 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Gameplay textures from resources/icons, addressed by index instead of file name
+enum class TextureId : std::uint8_t {
+    NormalBall,
+    MagneticBall,
+    TransparentBall,
+    ProtectionBall,
+    Coin,
+    RareCoin,
+    Cactus,
+    ClosedBox,
+    OpenBox,
+    FalconEnemy,
+    SquareEnemy,
+    SpeedGift,
+    ReverseMovementGift,
+    HeadwindStormGift,
+    LifeHeartGift,
+    ProtectiveShieldGift,
+    Heart,
+    Background,
+    Count
+};
+
+inline constexpr std::size_t TEXTURE_COUNT = static_cast<std::size_t>(TextureId::Count);
+
+/**
+ * @brief Resolves every gameplay texture once, through the shared texture cache
+ *
+ * A missing file is logged and leaves its slot empty; sprites using it are skipped.
+ */
+class GameTextures {
+public:
+    void load();
+
+    const sf::Texture* get(TextureId id) const { return m_textures[static_cast<std::size_t>(id)]; }
+    static const char* fileName(TextureId id);
+
+private:
+    std::array<const sf::Texture*, TEXTURE_COUNT> m_textures{};
+};
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "World.h"
+#include "Components.h"
+#include "TimerWheel.h"
+
+/**
+ * @brief Applies gift pickups and other power-ups as timed ball modifiers
+ *
+ * Each pickup adds one entry to the ball's Modifiers list (a fixed array,
+ * no allocation) with its own TimerWheel timer, so picking up the same gift
+ * twice stacks and each stack runs out on its own. Expirations come from
+ * the wheel - nothing scans the active modifiers per frame. When the list
+ * is full the stack closest to expiring is replaced.
+ *
+ * The ball's type and sprite follow its modifiers: a shield shows the
+ * protection ball, a magnet the magnetic ball.
+ */
+class GiftSystem {
+public:
+    static constexpr int MAX_LIVES = 5;
+
+    // Durations in seconds
+    static constexpr float SPEED_DURATION = 8.0f;
+    static constexpr float REVERSE_DURATION = 6.0f;
+    static constexpr float HEADWIND_DURATION = 7.0f;
+    static constexpr float SHIELD_DURATION = 10.0f;
+
+    // Movement effects per stack
+    static constexpr float SPEED_SCALE_PER_STACK = 1.35f;
+    static constexpr float MAX_SPEED_SCALE = 2.0f;
+    static constexpr float HEADWIND_ACCELERATION = 520.0f;  // px/s^2 pushing left
+
+    void collect(World& world, Entity ball, GiftType gift);
+    void addModifier(World& world, Entity ball, ModifierType type, float duration);
+    void update(World& world, float deltaTime);
+    void clear();
+
+    float getRemaining(World& world, Entity ball, ModifierType type);
+    std::size_t getActiveTimerCount() const { return m_timers.getActiveCount(); }
+
+    static float speedScale(const Modifiers& modifiers);
+    static float headwindAcceleration(const Modifiers& modifiers);
+
+private:
+    TimerWheel m_timers;
+    std::vector<TimerWheel::Expired> m_expired;
+
+    static std::uint64_t payloadFor(Entity entity);
+    static Entity entityFrom(std::uint64_t payload);
+    static void refreshBall(World& world, Entity ball, const Modifiers& modifiers);
+    void removeEntry(Modifiers& modifiers, std::size_t slot);
+};
@@ -0,0 +1,72 @@
+#pragma once
+#include <SFML/System.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class TileAtlas;
+struct TileColumn;
+
+// Object placed in the level file - spawned as an entity by the play screen
+struct LevelSpawn {
+    char code = 0;          // Level file character, e.g. 'c' coin, 'f' falcon
+    sf::Vector2i tile;
+    std::uint32_t id = 0;   // Stable across reloads of its column - dense, 0 .. getSpawnCount() - 1
+};
+
+/**
+ * @brief Parsed level file, kept run-length encoded so it can be streamed
+ *
+ * Level files are plain text:
+ *
+ *     # comment (only before the header - rows may start with ground)
+ *     DBLV <version> <width> <height>
+ *     <height run-length encoded rows>
+ *
+ * Each row is a sequence of [count]<char> runs ("12.[(6=)]" = 12 empty cells
+ * then a 10-tile platform). Terrain: '.' empty, '[' left edge, '(' left,
+ * '=' middle, ')' right, ']' right edge, '#' solid ground that is shaped into
+ * pieces automatically. 'P' marks the ball start; any other letter is an
+ * object spawn on an empty cell.
+ *
+ * parse() only validates the rows and keeps their runs (adjacent runs of the
+ * same character merged, so a ground run knows its full extent). Cells are
+ * never expanded for the whole level: buildColumn() decodes one column of
+ * chunks - tiles, baked vertices and spawns - on demand. The layout is
+ * immutable after parsing, so any thread may build columns from it.
+ */
+class LevelLayout {
+public:
+    static constexpr int FORMAT_VERSION = 1;
+
+    bool parse(std::string_view text);
+
+    // Thread-safe - the atlas must be built and is only read
+    std::unique_ptr<TileColumn> buildColumn(int column, const TileAtlas& atlas) const;
+
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+    int getColumnCount() const;
+    std::size_t getRunCount() const { return m_runs.size(); }
+    std::size_t getSpawnCount() const { return m_spawnCount; }
+    std::optional<sf::Vector2i> getBallStart() const { return m_ballStart; }
+
+private:
+    struct Run {
+        std::int32_t start = 0;
+        std::int32_t length = 0;
+        char code = '.';
+        std::uint32_t firstSpawn = 0;   // Id of the run's first object, in file order
+    };
+
+    int m_width = 0;
+    int m_height = 0;
+    std::vector<Run> m_runs;              // All rows, left to right
+    std::vector<std::size_t> m_rowStarts; // First run of each row, plus one past the end
+    std::optional<sf::Vector2i> m_ballStart;
+    std::size_t m_spawnCount = 0;
+};
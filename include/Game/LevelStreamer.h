@@ -0,0 +1,106 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "LockFreeQueue.h"
+#include "TileMap.h"
+
+// What happened to a level object since its column was first streamed in
+enum class SpawnState : std::uint8_t {
+    Fresh,
+    Consumed,   // Collected or killed - not spawned again
+    Opened      // Box that already handed out its power-up
+};
+
+/**
+ * @brief Streams level columns in and out of a TileMap around the camera
+ *
+ * Columns within LOAD_MARGIN columns of the view are requested from a small
+ * pool of workers, which decode the layout runs, bake the chunk vertices and
+ * gather the column's spawns. Finished columns come back through a
+ * LockFreeQueue, so the main thread only ever moves a pointer into the map
+ * - it never waits for a worker or takes a lock on the way back. Columns
+ * beyond UNLOAD_MARGIN are dropped (the gap between the two margins keeps a
+ * column from flickering in and out at a boundary), so memory stays bounded
+ * by the view size, not the level length.
+ *
+ * Requests run ahead of the camera, so a column normally arrives long before
+ * it is seen. If one under the view is still missing (a very slow worker),
+ * it is built on the main thread instead of showing a hole.
+ *
+ * Each update reports the spawns of the columns that arrived and the
+ * columns that were dropped, for the screen to create and destroy their
+ * entities. setSpawnState() remembers collected objects across reloads.
+ */
+class LevelStreamer {
+public:
+    static constexpr int LOAD_MARGIN = 2;       // Columns beyond each side of the view kept loaded
+    static constexpr int UNLOAD_MARGIN = 3;     // Columns beyond each side before one is dropped
+    static constexpr std::size_t RESULT_CAPACITY = 64;
+
+    LevelStreamer(TileMap& map, const TileAtlas& atlas, std::size_t workerCount = defaultWorkerCount());
+    ~LevelStreamer();
+
+    LevelStreamer(const LevelStreamer&) = delete;
+    LevelStreamer& operator=(const LevelStreamer&) = delete;
+
+    // Build the columns around `view` on this thread - before the first frame
+    void prime(const sf::FloatRect& view);
+
+    // Request, adopt and drop columns for the current view - call once per frame
+    void update(const sf::FloatRect& view);
+
+    // Results of the last prime() / update()
+    const std::vector<LevelSpawn>& getArrivedSpawns() const { return m_arrivedSpawns; }
+    const std::vector<int>& getDroppedColumns() const { return m_droppedColumns; }
+
+    void setSpawnState(std::uint32_t spawnId, SpawnState state);
+    SpawnState getSpawnState(std::uint32_t spawnId) const;
+
+    std::size_t getInFlightCount() const { return m_inFlight; }
+    std::size_t getMainThreadBuilds() const { return m_mainThreadBuilds; }
+
+    static std::size_t defaultWorkerCount();
+
+private:
+    enum class ColumnState : std::uint8_t {
+        Unloaded,
+        Requested,
+        Resident
+    };
+
+    void request(int column);
+    void adopt(std::unique_ptr<TileColumn> column);
+    void drop(int column);
+    void collectFinished();
+    void workerLoop(std::stop_token stopToken);
+    static sf::Vector2i columnRange(const sf::FloatRect& view, int margin, int columnCount);
+
+    TileMap& m_map;
+    const TileAtlas& m_atlas;
+    std::shared_ptr<const LevelLayout> m_layout;
+    std::vector<ColumnState> m_states;
+    std::vector<int> m_active;          // Columns requested or resident - a handful around the view
+    std::vector<SpawnState> m_spawnStates;   // By spawn id, sized in prime() - marking one never allocates
+    std::vector<LevelSpawn> m_arrivedSpawns;
+    std::vector<int> m_droppedColumns;
+    std::size_t m_inFlight = 0;
+    std::size_t m_mainThreadBuilds = 0;
+
+    // Main thread -> workers: rare and small, workers sleep on it
+    std::mutex m_requestMutex;
+    std::condition_variable_any m_requestReady;
+    std::deque<int> m_requests;
+
+    // Workers -> main thread: never blocks the frame
+    LockFreeQueue<std::unique_ptr<TileColumn>> m_finished{ RESULT_CAPACITY };
+
+    std::size_t m_workerCount;
+    std::vector<std::jthread> m_workers;   // Last member - joined before the queues go away
+};
@@ -0,0 +1,98 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+/**
+ * @brief Bounded multi-producer / multi-consumer queue without locks
+ *
+ * A ring of cells, each with a sequence number that says whose turn it is:
+ * a producer claims a cell by advancing the tail with a compare-exchange,
+ * writes the value, then publishes it by bumping the cell's sequence; a
+ * consumer does the mirror image on the head. Neither side ever waits on
+ * the other - a full or empty queue just makes tryPush / tryPop return false.
+ *
+ * The capacity is rounded up to a power of two and fixed at construction,
+ * so pushing and popping never allocate.
+ */
+template <typename T>
+class LockFreeQueue {
+public:
+    explicit LockFreeQueue(std::size_t capacity)
+        : m_mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1)
+        , m_cells(std::make_unique<Cell[]>(m_mask + 1)) {
+        for (std::size_t i = 0; i <= m_mask; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+    // False if the queue is full - the value is left untouched then
+    bool tryPush(T&& value) {
+        std::size_t position = m_tail.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = m_cells[position & m_mask];
+            std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+            if (difference == 0) {
+                if (m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0) {
+                return false;   // The consumer has not freed this cell yet
+            }
+            else {
+                position = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // False if the queue is empty
+    bool tryPop(T& value) {
+        std::size_t position = m_head.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = m_cells[position & m_mask];
+            std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+
+            if (difference == 0) {
+                if (m_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell.value);
+                    cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0) {
+                return false;   // Nothing published in this cell yet
+            }
+            else {
+                position = m_head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::size_t getCapacity() const { return m_mask + 1; }
+
+private:
+    // Producers and consumers hammer different ends - keep them off the same cache line
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> sequence{ 0 };
+        T value{};
+    };
+
+    const std::size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_tail{ 0 };
+    alignas(CACHE_LINE) std::atomic<std::size_t> m_head{ 0 };
+};
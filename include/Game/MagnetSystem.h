@@ -0,0 +1,29 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "World.h"
+#include "SpatialHash.h"
+#include "FrameArena.h"
+
+/**
+ * @brief Magnetic balls pull nearby coins towards them
+ *
+ * Coins around each magnetic ball are fetched from the physics broad phase,
+ * copied into x/y arrays, moved by the vectorized MagnetKernel and written
+ * back. The x/y arrays come from the frame arena, so gathering never
+ * touches the heap.
+ */
+class MagnetSystem {
+public:
+    static constexpr float FIELD_RADIUS = 320.0f;
+    static constexpr float PULL_SPEED = 260.0f;   // px/s at the edge of the field
+    static constexpr float CORE_SPEED = 900.0f;   // px/s next to the ball
+
+    void update(World& world, const SpatialHash& broadPhase, FrameArena& arena, float deltaTime);
+
+    std::size_t getLastGatheredCount() const { return m_lastGatheredCount; }
+
+private:
+    std::vector<Entity> m_candidates;
+    std::size_t m_lastGatheredCount = 0;
+};
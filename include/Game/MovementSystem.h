@@ -0,0 +1,8 @@
+#pragma once
+#include "World.h"
+
+// Integrates velocities into positions for every entity that has both (except circle colliders)
+class MovementSystem {
+public:
+    void update(World& world, float deltaTime);
+};
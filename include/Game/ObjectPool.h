@@ -0,0 +1,99 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Free-list pool for short-lived objects of one type
+ *
+ * Slots are allocated in blocks of BLOCK_SIZE and never returned to the
+ * heap, so pointers stay valid until release() and, once the pool has grown
+ * to the peak number of live objects, acquire()/release() never allocate.
+ * Released slots are threaded into an intrusive free list (last released is
+ * handed out first, which keeps recently touched memory warm).
+ */
+template <typename T>
+class ObjectPool {
+public:
+    static constexpr std::size_t BLOCK_SIZE = 64;
+
+    explicit ObjectPool(std::size_t initialCapacity = 0) {
+        reserve(initialCapacity);
+    }
+
+    ~ObjectPool() {
+        for (auto& block : m_blocks) {
+            for (std::size_t i = 0; i < BLOCK_SIZE; ++i) {
+                if (block[i].live) {
+                    block[i].object()->~T();
+                }
+            }
+        }
+    }
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    template <typename... Args>
+    T* acquire(Args&&... args) {
+        if (!m_freeList) {
+            addBlock();
+        }
+
+        Slot* slot = m_freeList;
+        T* object = new (slot->storage) T(std::forward<Args>(args)...);
+        m_freeList = slot->nextFree;
+        slot->nextFree = nullptr;
+        slot->live = true;
+        ++m_liveCount;
+        return object;
+    }
+
+    void release(T* object) {
+        if (!object) {
+            return;
+        }
+
+        // storage is the first member, so the object address is the slot address
+        Slot* slot = reinterpret_cast<Slot*>(object);
+        object->~T();
+        slot->live = false;
+        slot->nextFree = m_freeList;
+        m_freeList = slot;
+        --m_liveCount;
+    }
+
+    void reserve(std::size_t capacity) {
+        while (getCapacity() < capacity) {
+            addBlock();
+        }
+    }
+
+    std::size_t getCapacity() const { return m_blocks.size() * BLOCK_SIZE; }
+    std::size_t getLiveCount() const { return m_liveCount; }
+
+private:
+    struct Slot {
+        alignas(T) std::byte storage[sizeof(T)];
+        Slot* nextFree = nullptr;
+        bool live = false;
+
+        T* object() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> m_blocks;
+    Slot* m_freeList = nullptr;
+    std::size_t m_liveCount = 0;
+
+    void addBlock() {
+        auto block = std::make_unique<Slot[]>(BLOCK_SIZE);
+        // Thread the new slots in order so they are handed out front to back
+        for (std::size_t i = BLOCK_SIZE; i-- > 0;) {
+            block[i].nextFree = m_freeList;
+            m_freeList = &block[i];
+        }
+        m_blocks.push_back(std::move(block));
+    }
+};
@@ -0,0 +1,26 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+/**
+ * @brief Backdrop that scrolls slower than the level to give it depth
+ *
+ * The texture (repeated) is scaled to the canvas height and drawn as one
+ * quad covering the canvas; scrolling only shifts its texture coordinates
+ * by a fraction of the camera position, so it costs the same single draw
+ * however long the level is.
+ */
+class ParallaxBackground {
+public:
+    static constexpr float DEFAULT_FACTOR = 0.25f;   // Background moves a quarter as fast as the level
+
+    void setTexture(const sf::Texture* texture) { m_texture = texture; }
+    void setFactor(float factor) { m_factor = factor; }
+
+    // Drawn in canvas coordinates - call with the canvas view active
+    void render(sf::RenderTarget& target, sf::Vector2f canvasSize, float cameraX);
+
+private:
+    const sf::Texture* m_texture = nullptr;
+    float m_factor = DEFAULT_FACTOR;
+    sf::VertexArray m_quad{ sf::Triangles, 6 };
+};
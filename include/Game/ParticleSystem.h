@@ -0,0 +1,113 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <latch>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "GameTextures.h"
+
+enum class ParticleEffect : std::uint8_t {
+    Dust,           // Light ambient sand drifting through the level
+    Sandstorm,      // Dense headwind sand across the whole view
+    CoinSparkle,    // Golden glints when a coin is collected
+    CoinBurst,      // Small coins thrown out of a rare coin
+    Explosion,      // Fire and smoke when an enemy is destroyed
+    Count
+};
+
+// Index of a continuous emitter, or NO_EMITTER
+using EmitterId = int;
+inline constexpr EmitterId NO_EMITTER = -1;
+
+/**
+ * @brief CPU particles stored as structure-of-arrays, one buffer per texture
+ *
+ * Every attribute (x, y, vx, vy, ...) is its own array, so integration is a
+ * straight vectorized pass (SSE2/AVX, see Simd.h) over contiguous floats.
+ * Dead particles are removed by swapping the last one into their slot.
+ * Buffers are sized to MAX_PARTICLES up front and each renders through one
+ * reused sf::VertexArray, so emitting and drawing never allocate.
+ *
+ * With worker threads enabled, large updates are split into equal slices
+ * integrated in parallel; the main thread takes one slice and waits for
+ * the rest before compacting.
+ */
+class ParticleSystem {
+public:
+    static constexpr std::size_t MAX_PARTICLES = 65536;        // Per texture
+    static constexpr std::size_t PARALLEL_MIN_PARTICLES = 16384;
+    static constexpr std::size_t MAX_EMITTERS = 16;
+
+    explicit ParticleSystem(const GameTextures& textures);
+    ~ParticleSystem();
+
+    ParticleSystem(const ParticleSystem&) = delete;
+    ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+    // One-shot burst at a point
+    void burst(ParticleEffect effect, sf::Vector2f position);
+
+    // Continuous emission over an area (e.g. the visible part of the level)
+    EmitterId addEmitter(ParticleEffect effect, const sf::FloatRect& area);
+    void setEmitterArea(EmitterId emitter, const sf::FloatRect& area);
+    void removeEmitter(EmitterId emitter);
+
+    void update(float deltaTime);
+    void render(sf::RenderTarget& target);
+    void clear();
+
+    // 0 keeps the update on the calling thread
+    void setWorkerCount(std::size_t workerCount);
+    static std::size_t defaultWorkerCount();
+
+    std::size_t getParticleCount() const;
+
+private:
+    enum class Texture : std::uint8_t {
+        Dot,    // Generated soft round dot, tinted per effect
+        Coin,
+        Count
+    };
+    static constexpr std::size_t TEXTURE_SLOTS = static_cast<std::size_t>(Texture::Count);
+
+    struct Buffer {
+        std::vector<float> x, y, vx, vy, ax, ay, age, lifetime;
+        std::vector<ParticleEffect> effect;
+        std::size_t count = 0;
+        sf::VertexArray vertices{ sf::Triangles };
+    };
+
+    struct Emitter {
+        ParticleEffect effect = ParticleEffect::Dust;
+        sf::FloatRect area;
+        float pending = 0.0f;   // Fractional particles carried to the next update
+        bool active = false;
+    };
+
+    const GameTextures& m_textures;
+    sf::Texture m_dotTexture;
+    std::array<Buffer, TEXTURE_SLOTS> m_buffers;
+    std::array<Emitter, MAX_EMITTERS> m_emitters;
+    std::minstd_rand m_random;
+
+    // Parallel integration - workers wait for a new job generation
+    std::mutex m_jobMutex;
+    std::condition_variable_any m_jobReady;
+    std::uint64_t m_jobGeneration = 0;
+    float m_jobDelta = 0.0f;
+    std::latch* m_jobDone = nullptr;
+    std::vector<std::jthread> m_workers;   // Last - stopped before the state they use
+
+    void emit(ParticleEffect effect, sf::Vector2f position);
+    void integrateSlice(std::size_t slice, std::size_t sliceCount, float deltaTime);
+    void removeExpired(Buffer& buffer);
+    void workerLoop(std::stop_token stopToken, std::size_t slice, std::uint64_t seenGeneration);
+    const sf::Texture* textureFor(Texture texture) const;
+    float random(float min, float max);
+    void createDotTexture();
+};
@@ -0,0 +1,47 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "World.h"
+#include "SpatialHash.h"
+#include "TileMap.h"
+
+// A ball touched another collider this tick
+struct Contact {
+    Entity ball;
+    Entity other;
+};
+
+/**
+ * @brief Ball physics - broad phase, swept narrow phase and contact reporting
+ *
+ * Box colliders are kept in a SpatialHash that is refreshed incrementally
+ * every tick. Balls (CircleCollider) are moved here with continuous
+ * collision: the displacement is swept against nearby tiles and solid boxes,
+ * the ball stops at the first hit and slides along it for the rest of the
+ * step, so it cannot pass through a tile however fast it moves.
+ *
+ * Contacts with any box collider along the path are collected for the
+ * screen to act on (coins, cacti, enemies ...).
+ */
+class PhysicsSystem {
+public:
+    static constexpr int MAX_SWEEPS = 4;            // Slides per ball per tick
+    static constexpr float SKIN = 0.05f;            // Gap kept to surfaces, px
+    static constexpr float GROUND_NORMAL_Y = -0.7f; // Steeper than ~45 degrees counts as floor
+
+    void update(World& world, const TileMap& map, float deltaTime);
+
+    const std::vector<Contact>& getContacts() const { return m_contacts; }
+    const SpatialHash& getBroadPhase() const { return m_broadPhase; }
+
+private:
+    void syncBroadPhase(World& world);
+    void moveBall(World& world, const TileMap& map, Entity ball, float radius, float deltaTime);
+    void gatherObstacles(World& world, const TileMap& map, const sf::FloatRect& area);
+    void collectContacts(World& world, Entity ball, sf::Vector2f start, sf::Vector2f end, float radius);
+
+    SpatialHash m_broadPhase;
+    std::vector<Entity> m_candidates;
+    std::vector<sf::FloatRect> m_obstacles;
+    std::vector<Contact> m_contacts;
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+// Instruction set used by the vectorized gameplay kernels, picked at compile time.
+// MSVC x64 always has SSE2; AVX needs /arch:AVX (or -mavx).
+#if defined(__AVX__)
+#include <immintrin.h>
+#define GAME_SIMD_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GAME_SIMD_SSE2
+#endif
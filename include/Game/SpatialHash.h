@@ -0,0 +1,71 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Entity.h"
+
+/**
+ * @brief Uniform-grid broad phase keyed by hashed cell coordinates
+ *
+ * Each tick the owner calls beginUpdate(), update() for every collider and
+ * endUpdate(). An entity is only relinked when the range of cells its bounds
+ * cover changes, so the static bulk of a level (coins, cacti, boxes) costs a
+ * comparison per tick, and entities not updated are dropped in endUpdate().
+ * Queries visit only the cells under the area, keeping checks proportional
+ * to the colliders nearby instead of all pairs.
+ *
+ * Cells hash into a fixed table of buckets; distant cells may share a
+ * bucket, which only costs a bounds check. Buckets keep their capacity, so
+ * relinking moving colliders stops allocating once the table is warm.
+ */
+class SpatialHash {
+public:
+    static constexpr float DEFAULT_CELL_SIZE = 128.0f;
+    static constexpr std::size_t BUCKET_COUNT = 4096;  // Power of two
+
+    explicit SpatialHash(float cellSize = DEFAULT_CELL_SIZE);
+
+    void beginUpdate();
+    void update(Entity entity, const sf::FloatRect& bounds);
+    void endUpdate();
+    void clear();
+
+    // Entities whose bounds intersect the area, each reported once
+    void query(const sf::FloatRect& area, std::vector<Entity>& results) const;
+
+    std::size_t getProxyCount() const { return m_proxyCount; }
+    std::size_t getBucketCount() const { return m_buckets.size(); }
+
+private:
+    struct CellRange {
+        int minX = 0;
+        int minY = 0;
+        int maxX = -1;
+        int maxY = -1;
+
+        bool operator==(const CellRange&) const = default;
+    };
+
+    struct Proxy {
+        Entity entity;
+        sf::FloatRect bounds;
+        CellRange cells;
+        std::uint32_t lastUpdate = 0;
+        mutable std::uint32_t lastQuery = 0;
+        bool active = false;
+    };
+
+    float m_cellSize;
+    float m_inverseCellSize;
+    std::vector<std::vector<std::uint32_t>> m_buckets;
+    std::vector<Proxy> m_proxies;   // Indexed by entity index
+    std::size_t m_proxyCount = 0;
+    std::uint32_t m_updateStamp = 0;
+    mutable std::uint32_t m_queryStamp = 0;
+
+    CellRange cellsFor(const sf::FloatRect& bounds) const;
+    static std::size_t bucketFor(int x, int y);
+    void link(std::uint32_t index, const CellRange& cells);
+    void unlink(std::uint32_t index, const CellRange& cells);
+};
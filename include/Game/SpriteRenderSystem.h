@@ -0,0 +1,39 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <span>
+#include "World.h"
+#include "GameTextures.h"
+
+/**
+ * @brief Draws sprites with one draw call per texture
+ *
+ * Only the entities passed in are considered - the caller culls with the
+ * spatial index (see Camera::collectVisible), so the cost follows what is on
+ * screen rather than the level size. Each sprite is still checked against
+ * the exact view, since index cells are coarser than the screen edge.
+ *
+ * Visible sprites are appended as two triangles to the vertex array of their
+ * texture; the arrays are reused between frames so they stop allocating once
+ * they have grown to the level's needs.
+ */
+class SpriteRenderSystem {
+public:
+    explicit SpriteRenderSystem(const GameTextures& textures);
+
+    void render(World& world, std::span<const Entity> candidates, sf::RenderTarget& target);
+
+    std::size_t getLastDrawCalls() const { return m_lastDrawCalls; }
+    std::size_t getLastSpriteCount() const { return m_lastSpriteCount; }
+
+    // Two triangles covering the whole texture, tinted by `color`
+    static void appendQuad(sf::VertexArray& batch, sf::Vector2f center, sf::Vector2f size, sf::Vector2u textureSize,
+        sf::Color color = sf::Color::White);
+
+private:
+    const GameTextures& m_textures;
+    std::array<sf::VertexArray, TEXTURE_COUNT> m_batches;
+    std::size_t m_lastDrawCalls = 0;
+    std::size_t m_lastSpriteCount = 0;
+};
@@ -0,0 +1,50 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Terrain pieces - values are stored as-is in TileMap cells
+enum class TileType : std::uint8_t {
+    Empty,
+    LeftEdge,
+    Left,
+    Middle,
+    Right,
+    RightEdge,
+    Count
+};
+
+inline constexpr std::size_t TILE_TYPE_COUNT = static_cast<std::size_t>(TileType::Count);
+
+/**
+ * @brief Packs the terrain pieces into a single texture
+ *
+ * The source images are large (up to 1024x1024) and separate, which would
+ * force one texture switch per piece. build() renders them downscaled into
+ * one atlas so a whole chunk of terrain draws with a single texture bind.
+ * Cells are padded so smoothing never samples a neighbouring piece.
+ */
+class TileAtlas {
+public:
+    static constexpr unsigned int CELL_SIZE = 256;  // Atlas pixels per tile
+    static constexpr unsigned int CELL_PADDING = 4;
+
+    // Piece geometry inside its tile cell, in fractions of the tile size
+    struct Piece {
+        sf::FloatRect textureRect;  // Atlas pixels
+        float left = 0.0f;
+        float width = 1.0f;
+    };
+
+    bool build();
+
+    const sf::Texture& getTexture() const { return m_texture; }
+    const Piece& piece(TileType type) const { return m_pieces[static_cast<std::size_t>(type)]; }
+
+    static const char* fileName(TileType type);
+
+private:
+    sf::Texture m_texture;
+    std::array<Piece, TILE_TYPE_COUNT> m_pieces{};
+};
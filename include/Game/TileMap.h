@@ -0,0 +1,82 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "LevelLayout.h"
+#include "TileAtlas.h"
+
+// CHUNK_TILES x CHUNK_TILES tiles baked into one vertex array
+struct TileChunk {
+    sf::VertexArray vertices{ sf::Triangles };
+    sf::FloatRect bounds;
+};
+
+// One CHUNK_TILES wide strip of the level, full height - the unit that is streamed in and out
+struct TileColumn {
+    int index = 0;
+    std::vector<TileType> tiles;        // CHUNK_TILES cells per row, row-major
+    std::vector<TileChunk> chunks;      // Top to bottom
+    std::vector<LevelSpawn> spawns;     // Objects placed in this strip
+};
+
+/**
+ * @brief Terrain of the resident part of a level, split into chunks baked into vertex arrays
+ *
+ * The level itself is a LevelLayout (see there for the file format). Only
+ * the columns handed in with setColumn() exist as tiles and vertices - the
+ * rest of the level reads as empty until it is streamed in (LevelStreamer),
+ * so memory follows the area around the camera, not the level length.
+ *
+ * Drawing costs one draw call per resident chunk in view; the columns to
+ * look at are found from the view directly, not by walking the level.
+ */
+class TileMap {
+public:
+    static constexpr float TILE_SIZE = 64.0f;
+    static constexpr int CHUNK_TILES = 16;
+
+    // Parse the layout only - no column is resident afterwards
+    bool loadFromFile(const std::string& filePath, const TileAtlas& atlas);
+    bool parse(std::string_view text, const TileAtlas& atlas);
+
+    // Shared with the streaming workers, which build columns from it
+    std::shared_ptr<const LevelLayout> getLayout() const { return m_layout; }
+    const TileAtlas* getAtlas() const { return m_atlas; }
+
+    // Take over a built column (replacing one already resident at its index)
+    void setColumn(std::unique_ptr<TileColumn> column);
+    std::unique_ptr<TileColumn> releaseColumn(int index);
+    bool isResident(int column) const;
+    int getColumnCount() const { return static_cast<int>(m_columns.size()); }
+    std::size_t getResidentCount() const { return m_residentCount; }
+    static int columnOf(float x);
+
+    void render(sf::RenderTarget& target) const;
+
+    TileType getTile(int x, int y) const;
+    bool isSolid(int x, int y) const { return getTile(x, y) != TileType::Empty; }
+
+    // World-space collision box of a tile (edge caps are narrower than a full cell)
+    sf::FloatRect getTileBounds(int x, int y) const;
+    sf::Vector2i toTile(sf::Vector2f position) const;
+    static sf::Vector2f tileCenter(sf::Vector2i tile);
+
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+    sf::Vector2f getPixelSize() const { return sf::Vector2f(m_width * TILE_SIZE, m_height * TILE_SIZE); }
+
+    std::size_t getLastDrawCalls() const { return m_lastDrawCalls; }
+
+private:
+    int m_width = 0;
+    int m_height = 0;
+    std::shared_ptr<const LevelLayout> m_layout;
+    std::vector<std::unique_ptr<TileColumn>> m_columns;   // Null while not resident
+    std::size_t m_residentCount = 0;
+    const TileAtlas* m_atlas = nullptr;
+    mutable std::size_t m_lastDrawCalls = 0;
+};
@@ -0,0 +1,75 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Handle to a scheduled timer - stale handles are ignored by cancel()
+struct TimerId {
+    static constexpr std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t index = INVALID_INDEX;
+    std::uint32_t generation = 0;
+
+    bool isValid() const { return index != INVALID_INDEX; }
+    bool operator==(const TimerId&) const = default;
+};
+
+/**
+ * @brief Hashed timing wheel for gameplay expirations
+ *
+ * Time advances in fixed ticks; a timer is linked into the slot of its
+ * deadline tick (modulo SLOT_COUNT). Each tick only walks that one slot -
+ * timers due in a later revolution are skipped there - so the per-frame
+ * cost depends on how many timers share the slot, not on how many are
+ * active. Scheduling and cancelling are O(1) via intrusive index links;
+ * timer records are recycled through a free list.
+ */
+class TimerWheel {
+public:
+    static constexpr float TICK_SECONDS = 1.0f / 32.0f;
+    static constexpr std::size_t SLOT_COUNT = 256;   // 8 seconds per revolution
+
+    struct Expired {
+        TimerId id;
+        std::uint64_t payload = 0;
+    };
+
+    explicit TimerWheel(std::size_t initialCapacity = 256);
+
+    TimerId schedule(float delaySeconds, std::uint64_t payload);
+    bool cancel(TimerId id);
+
+    bool isActive(TimerId id) const;
+    float getRemaining(TimerId id) const;
+
+    // Move time forward and append every timer that fired
+    void advance(float deltaTime, std::vector<Expired>& expired);
+    void clear();
+
+    std::size_t getActiveCount() const { return m_activeCount; }
+
+private:
+    static constexpr std::uint32_t NONE = std::numeric_limits<std::uint32_t>::max();
+
+    struct Timer {
+        std::uint64_t deadline = 0;   // Tick it fires on
+        std::uint64_t payload = 0;
+        std::uint32_t next = NONE;
+        std::uint32_t previous = NONE;
+        std::uint32_t generation = 0;
+        bool active = false;
+    };
+
+    std::vector<Timer> m_timers;
+    std::vector<std::uint32_t> m_freeTimers;
+    std::array<std::uint32_t, SLOT_COUNT> m_slots;
+    std::uint64_t m_currentTick = 0;
+    float m_accumulator = 0.0f;
+    std::size_t m_activeCount = 0;
+
+    void link(std::uint32_t index);
+    void unlink(std::uint32_t index);
+    void release(std::uint32_t index);
+};
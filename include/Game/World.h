@@ -0,0 +1,86 @@
+#pragma once
+#include "ComponentPool.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Entity/component store for the PLAY screen
+ *
+ * Entities are generational handles; components live in one dense pool per
+ * type (see ComponentPool). Pools are created on first use and looked up by
+ * a per-type index - no hashing or RTTI on the hot path.
+ *
+ * Destroying an entity while a system iterates a pool would reorder it, so
+ * systems call destroyLater() and the screen calls flushDestroyed() once the
+ * tick is over.
+ */
+class World {
+public:
+    Entity create();
+    void destroy(Entity entity);
+    void destroyLater(Entity entity);
+    void flushDestroyed();
+    void clear();
+
+    bool isAlive(Entity entity) const {
+        return entity.index < m_generations.size()
+            && m_generations[entity.index] == entity.generation
+            && m_alive[entity.index];
+    }
+
+    std::size_t getAliveCount() const { return m_aliveCount; }
+
+    template <typename T>
+    ComponentPool<T>& pool() {
+        std::size_t id = componentTypeId<T>();
+        if (id >= m_pools.size()) {
+            m_pools.resize(id + 1);
+        }
+        if (!m_pools[id]) {
+            m_pools[id] = std::make_unique<ComponentPool<T>>();
+        }
+        return static_cast<ComponentPool<T>&>(*m_pools[id]);
+    }
+
+    // Null (nothing added) if the entity is dead - its index may already belong to another
+    template <typename T>
+    T* add(Entity entity, T component = {}) {
+        return isAlive(entity) ? &pool<T>().add(entity, std::move(component)) : nullptr;
+    }
+
+    // Null if the entity is dead or lacks the component
+    template <typename T>
+    T* tryGet(Entity entity) {
+        return isAlive(entity) ? pool<T>().tryGet(entity.index) : nullptr;
+    }
+
+    template <typename T>
+    bool has(Entity entity) {
+        return isAlive(entity) && pool<T>().has(entity.index);
+    }
+
+    template <typename T>
+    void remove(Entity entity) {
+        if (isAlive(entity)) {
+            pool<T>().removeIndex(entity.index);
+        }
+    }
+
+private:
+    static std::size_t nextComponentTypeId();
+
+    template <typename T>
+    static std::size_t componentTypeId() {
+        static const std::size_t id = nextComponentTypeId();
+        return id;
+    }
+
+    std::vector<std::uint32_t> m_generations;
+    std::vector<bool> m_alive;
+    std::vector<std::uint32_t> m_freeIndices;
+    std::vector<Entity> m_pendingDestroy;
+    std::size_t m_aliveCount = 0;
+
+    std::vector<std::unique_ptr<IComponentPool>> m_pools;
+};
@@ -6,7 +6,7 @@
 class AboutScreen : public IScreen {
 public:
     AboutScreen();
-    void handleEvents(sf::RenderWindow& window) override;
+    void registerInputHandlers(InputEventBus& bus) override;
     void update(float deltaTime) override;
     void render(sf::RenderWindow& window) override;
 
@@ -0,0 +1,19 @@
+#pragma once
+#include "../Core/IScreen.h"
+#include "../UI/HighScoreBoard.h"
+#include <SFML/Graphics.hpp>
+#include <memory>
+
+class GameOverScreen : public IScreen {
+public:
+    GameOverScreen();
+
+    void registerInputHandlers(InputEventBus& bus) override;
+    void update(float deltaTime) override;
+    void render(sf::RenderWindow& window) override;
+
+private:
+    sf::Texture m_backgroundTexture;
+    sf::Sprite m_backgroundSprite;
+    std::unique_ptr<HighScoreBoard> m_scoreBoard;
+};
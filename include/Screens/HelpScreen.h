@@ -7,7 +7,7 @@ class HelpScreen : public IScreen {
 public:
     HelpScreen();
 
-    void handleEvents(sf::RenderWindow& window) override;
+    void registerInputHandlers(InputEventBus& bus) override;
     void update(float deltaTime) override;
     void render(sf::RenderWindow& window) override;
 
@@ -7,7 +7,7 @@ class LoadingScreen : public IScreen {
 public:
     LoadingScreen();
 
-    void handleEvents(sf::RenderWindow& window) override;
+    void registerInputHandlers(InputEventBus& bus) override;
     void update(float deltaTime) override;
     void render(sf::RenderWindow& window) override;
 
@@ -21,4 +21,13 @@ private:
     // Background image
     sf::Texture m_backgroundTexture;
     sf::Sprite m_backgroundSprite;
+
+    // Progress bar - laid out once in virtual coordinates
+    sf::RectangleShape m_progressBar;
+    sf::RectangleShape m_progressFrame;
+
+    static constexpr float PROGRESS_BAR_MARGIN = 80.0f;
+    inline static const sf::Vector2f PROGRESS_BAR_SIZE = sf::Vector2f(400.0f, 20.0f);
+
+    void setupProgressBar();
 };
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include "../UI/MenuButtonObserver.h"
 #include "../UI/Button.h"
 #include "../UI/ButtonFactory.h"
+#include "../UI/TextEffect.h"
+#include "../UI/HitTestGrid.h"
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <Button.h>
@@ -15,7 +17,7 @@ public:
     ~MenuScreen() = default;
 
     // IScreen interface implementation
-    void handleEvents(sf::RenderWindow& window) override;
+    void registerInputHandlers(InputEventBus& bus) override;
     void update(float deltaTime) override;
     void render(sf::RenderWindow& window) override;
 
@@ -23,6 +25,7 @@ private:
     // Font for text rendering
     sf::Font m_font;
     sf::Text m_titleText;
+    TextEffect m_titleEffect;
 
     // Background image
     sf::Texture m_backgroundTexture;
@@ -37,8 +40,15 @@ private:
     std::vector<std::unique_ptr<ObservableButton>> m_observableButtons;
     std::shared_ptr<MenuButtonObserver> m_buttonObserver;
 
+    // Pointer routing - grid ids match indices in m_observableButtons
+    HitTestGrid m_hitGrid;
+    std::vector<HitTestGrid::WidgetId> m_hoveredButtons;
+
     // Private helper methods
     void setupButtons();
+    void rebuildHitGrid();
+    void routeMouseMove(const sf::Vector2f& mousePos);
+    bool dispatchClick(const sf::Vector2f& mousePos);
     void updateSelection(int direction);
     void selectCurrentButton();
 };
\ No newline at end of file
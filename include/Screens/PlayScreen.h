@@ -0,0 +1,102 @@
+#pragma once
+#include "../Core/IScreen.h"
+#include "../Game/World.h"
+#include "../Game/Components.h"
+#include "../Game/GameTextures.h"
+#include "../Game/MovementSystem.h"
+#include "../Game/SpriteRenderSystem.h"
+#include "../Game/BallController.h"
+#include "../Game/PhysicsSystem.h"
+#include "../Game/MagnetSystem.h"
+#include "../Game/GiftSystem.h"
+#include "../Game/EnemyAISystem.h"
+#include "../Game/EffectSystem.h"
+#include "../Game/ParticleSystem.h"
+#include "../Game/FrameArena.h"
+#include "../Game/TileAtlas.h"
+#include "../Game/TileMap.h"
+#include "../Game/LevelStreamer.h"
+#include "../Game/Camera.h"
+#include "../Game/ParallaxBackground.h"
+#include "../Core/AudioManager.h"
+#include "../Config/ScreenTypes.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+/**
+ * @brief Gameplay screen - the ball, coins, cacti, boxes, gifts and enemies
+ *
+ * All gameplay objects are entities in m_world; the screen only wires input
+ * to the systems and runs them in a fixed order every frame.
+ */
+class PlayScreen : public IScreen {
+public:
+    PlayScreen();
+
+    void registerInputHandlers(InputEventBus& bus) override;
+    void update(float deltaTime) override;
+    void render(sf::RenderWindow& window) override;
+
+private:
+    static constexpr const char* LEVEL_FILE = "level1.lvl";
+    static constexpr float MAGNET_DURATION = 10.0f;   // Seconds a box's magnetic ball lasts
+    static constexpr std::size_t FRAME_ARENA_BYTES = 256 * 1024;
+    static constexpr int ENEMY_SCORE = 3;
+    static constexpr float STOMP_BOUNCE = 560.0f;      // px/s upwards after landing on an enemy
+    static constexpr const char* PLAYER_NAME = "Player";
+
+    Entity spawn(EntityKind kind, TextureId texture, sf::Vector2f position, sf::Vector2f size);
+    void spawnBall();
+    void spawnObject(const LevelSpawn& levelSpawn);
+    void despawnColumn(int column);
+    void streamLevel();
+    void markSpawn(Entity entity, SpawnState state);
+    void handleContacts();
+    void openBox(Entity box);
+    void collectGift(Entity gift);
+    void hitEnemy(Entity enemy);
+    void killEnemy(Entity enemy);
+    void loseLife();
+    void endGame(ScreenType result);
+    void updateStorm();
+    void checkFallOut();
+    void followBall(float deltaTime);
+    void updateFalconSounds();
+
+    World m_world;
+    GameTextures m_textures;
+    MovementSystem m_movement;
+    SpriteRenderSystem m_spriteRenderer;
+    BallController m_ballController;
+    PhysicsSystem m_physics;
+    MagnetSystem m_magnets;
+    GiftSystem m_gifts;
+    EnemyAISystem m_enemies;
+    EffectSystem m_effects;
+    ParticleSystem m_particles;
+    EmitterId m_dustEmitter = NO_EMITTER;
+    EmitterId m_stormEmitter = NO_EMITTER;   // Only while a headwind is active
+    FrameArena m_frameArena;
+    TileAtlas m_tileAtlas;
+    TileMap m_tileMap;
+    LevelStreamer m_streamer;
+
+    Entity m_ball;
+    BallInput m_input;
+    bool m_leftHeld = false;
+    bool m_rightHeld = false;
+    sf::Vector2f m_ballStart;
+    bool m_gameOver = false;   // Result submitted - the screen change happens after this frame
+
+    Camera m_camera;
+    ParallaxBackground m_background;
+    std::vector<Entity> m_visible;   // Reused every frame for culling
+    SoundId m_falconSound = INVALID_SOUND;
+
+    // Swoop sounds follow their falcon until the sound ends
+    struct TrackedVoice {
+        Entity source;
+        VoiceHandle voice;
+    };
+    std::vector<TrackedVoice> m_falconVoices;
+};
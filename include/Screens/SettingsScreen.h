@@ -12,7 +12,7 @@ public:
     SettingsScreen();
     ~SettingsScreen() = default;
 
-    void handleEvents(sf::RenderWindow& window) override;
+    void registerInputHandlers(InputEventBus& bus) override;
     void update(float deltaTime) override;
     void render(sf::RenderWindow& window) override;
 
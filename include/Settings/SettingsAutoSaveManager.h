@@ -18,7 +18,7 @@ public:
      * @brief Configure auto-save settings
      */
     void enableAutoSave(bool enable) { m_autoSaveEnabled = enable; }
-    void setAutoSaveDelay(float seconds) { m_autoSaveDelay = seconds; }
+    void setAutoSaveDelay(float seconds); // Debounce of the settings file writer
 
     bool isAutoSaveEnabled() const { return m_autoSaveEnabled; }
     float getAutoSaveDelay() const { return m_autoSaveDelay; }
@@ -28,6 +28,11 @@ public:
      */
     void setVolumePanel(std::shared_ptr<VolumeControlPanel> panel);
 
+    /**
+     * @brief Per-frame check - hands panel changes to the debounced writer
+     */
+    void update();
+
     /**
      * @brief Save operations
      */
@@ -25,6 +25,7 @@ public:
     bool isMouseOver(const sf::Vector2f& mousePos) const {
         return m_model.getBounds().contains(mousePos);
     }
+    sf::FloatRect getBounds() const { return m_model.getBounds(); }
 
     void setButtonImage(const sf::Texture* texture);
     void setBackgroundColor(const sf::Color& color);
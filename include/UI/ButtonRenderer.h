@@ -17,6 +17,14 @@ private:
     sf::Sprite m_sprite;
     sf::Text m_text;
 
+    // Hover glow - GPU quad (face + glow in one draw) or reused CPU rectangle
+    sf::VertexArray m_glowQuad;
+    sf::RectangleShape m_glow;
+
+    static constexpr float GLOW_MARGIN = 10.0f;
+
     void updateGraphics();
     void updateTextPosition();
+    void drawFace(sf::RenderWindow& window);
+    bool drawFaceWithShaderGlow(sf::RenderWindow& window, const sf::Vector2f& position, const sf::Vector2f& size);
 };
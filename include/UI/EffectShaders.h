@@ -0,0 +1,45 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+/**
+ * @brief Shared GLSL effects for UI glow, drop shadow and pulsing
+ *
+ * Shaders are compiled lazily on first use. When the driver has no shader
+ * support (or compilation fails, or effects are disabled) callers are expected
+ * to take their CPU fallback path - check isAvailable() before asking for a shader.
+ */
+class EffectShaders {
+public:
+    static EffectShaders& instance(); // Singleton
+
+    // True when shaders are supported, compiled and enabled
+    bool isAvailable();
+
+    // Force the CPU fallback path (e.g. for debugging or weak GPUs)
+    void setEnabled(bool enabled) { m_enabled = enabled; }
+    bool isEnabled() const { return m_enabled; }
+
+    // Button glow: draws the button face and its outer glow in a single pass
+    sf::Shader* glowShader();
+
+    // Baked text: draws text plus drop shadow in a single pass
+    sf::Shader* textShadowShader();
+
+    // Shared animation clock for pulsing effects (seconds)
+    float getTime() const { return m_clock.getElapsedTime().asSeconds(); }
+
+private:
+    EffectShaders() = default;
+    EffectShaders(const EffectShaders&) = delete;
+    EffectShaders& operator=(const EffectShaders&) = delete;
+
+    void compile();
+
+    sf::Shader m_glowShader;
+    sf::Shader m_textShadowShader;
+    sf::Clock m_clock;
+
+    bool m_enabled = true;
+    bool m_compiled = false;
+    bool m_compileAttempted = false;
+};
@@ -0,0 +1,28 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <optional>
+#include <vector>
+#include "HighScoreTable.h"
+
+/**
+ * @brief Ranking panel for the result screens
+ *
+ * Built once from the table (already sorted in memory), so showing it costs
+ * nothing per frame beyond drawing. The latest submitted score is highlighted.
+ */
+class HighScoreBoard {
+public:
+    HighScoreBoard(const sf::Font& font, const HighScoreTable& table, sf::Vector2f center);
+
+    void render(sf::RenderWindow& window) const;
+
+private:
+    static constexpr unsigned int TITLE_SIZE = 34;
+    static constexpr unsigned int ROW_SIZE = 24;
+    static constexpr float ROW_SPACING = 32.0f;
+    static constexpr float PANEL_WIDTH = 420.0f;
+
+    sf::RectangleShape m_panel;
+    sf::Text m_title;
+    std::vector<sf::Text> m_rows;
+};
@@ -0,0 +1,59 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+#include "LayoutManager.h"
+
+/**
+ * @brief Uniform-grid spatial index over widget bounds for pointer hit-testing
+ *
+ * Widgets register their bounds once (ids are assigned in insertion order) and
+ * each cell keeps the ids of the widgets overlapping it. A pointer query looks at
+ * a single cell and tests only the widgets stored there, so the cost of routing
+ * a mouse event stays flat as a screen gains widgets.
+ *
+ * Bounds are cached here - callers update them with setBounds() when a widget
+ * moves or resizes instead of rebuilding rectangles on every event.
+ * Points outside the indexed area fall into the nearest edge cell.
+ */
+class HitTestGrid {
+public:
+    using WidgetId = std::size_t;
+
+    static constexpr float DEFAULT_CELL_SIZE = 100.0f;
+
+    explicit HitTestGrid(const sf::Vector2f& area = sf::Vector2f(LayoutManager::VIRTUAL_WIDTH, LayoutManager::VIRTUAL_HEIGHT),
+        float cellSize = DEFAULT_CELL_SIZE);
+
+    // Register widget bounds - returns the id (equal to the number of widgets inserted before it)
+    WidgetId insert(const sf::FloatRect& bounds);
+
+    // Move or resize a registered widget
+    void setBounds(WidgetId id, const sf::FloatRect& bounds);
+    const sf::FloatRect& getBounds(WidgetId id) const { return m_bounds[id]; }
+
+    void clear();
+    std::size_t size() const { return m_bounds.size(); }
+
+    /**
+     * @brief Widgets whose bounds contain the point, in insertion order
+     *
+     * The returned vector is reused by the next query - copy it if it must outlive that.
+     */
+    const std::vector<WidgetId>& query(const sf::Vector2f& point);
+
+private:
+    sf::Vector2f m_area;
+    float m_cellSize;
+    int m_columns;
+    int m_rows;
+
+    std::vector<std::vector<WidgetId>> m_cells;
+    std::vector<sf::FloatRect> m_bounds;
+    std::vector<WidgetId> m_hits;
+
+    int columnAt(float x) const;
+    int rowAt(float y) const;
+    void addToCells(WidgetId id, const sf::FloatRect& bounds);
+    void removeFromCells(WidgetId id, const sf::FloatRect& bounds);
+};
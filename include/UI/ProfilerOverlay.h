@@ -0,0 +1,49 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Debug overlay with frame timing, input queue, heap allocations and latency histograms
+ *
+ * Toggled with F3 (latency measurement itself is toggled with F4).
+ * The text is rebuilt a few times per second, not every frame.
+ */
+class ProfilerOverlay {
+public:
+    ProfilerOverlay();
+
+    void toggle() { m_visible = !m_visible; }
+    bool isVisible() const { return m_visible; }
+
+    // Feed per-frame statistics (cheap - accumulates only)
+    void update(float deltaTime, std::size_t polledEvents, std::size_t queuedEvents);
+    void render(sf::RenderWindow& window);
+
+private:
+    static constexpr float REFRESH_INTERVAL = 0.25f;
+    static constexpr int HISTOGRAM_BAR_WIDTH = 20;
+
+    bool m_visible = false;
+    bool m_fontAttempted = false;
+    bool m_hasFont = false;
+
+    sf::Text m_text;
+    sf::RectangleShape m_panel;
+
+    // Accumulated since the last refresh
+    float m_refreshTimer = 0.0f;
+    float m_frameTimeTotal = 0.0f;
+    float m_worstFrameTime = 0.0f;
+    int m_frameCount = 0;
+    std::size_t m_polledEvents = 0;
+    std::size_t m_queuedEvents = 0;
+    std::uint64_t m_allocations = 0;
+    std::uint64_t m_worstFrameAllocations = 0;
+
+    // Main-thread allocation count at the end of the previous update
+    std::uint64_t m_allocationMark = 0;
+
+    bool ensureFont();
+    void rebuildText();
+};
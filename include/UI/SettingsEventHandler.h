@@ -14,15 +14,14 @@ public:
     // Component registration
     void setVolumePanel(std::shared_ptr<VolumeControlPanel> panel);
 
-    // Event handling 
-    void handleEvents(sf::RenderWindow& window);
+    // Event handling - events are polled once per frame by the game loop
+    void handleEvent(const sf::Event& event);
 
     // Safe cleanup 
     void cleanup();
 
 private:
     // Event handling methods 
-    void handleWindowEvents(sf::RenderWindow& window, const sf::Event& event);
     void handleKeyboardEvents(const sf::Event& event);
     void handleMouseEvents(const sf::Event& event);
 
@@ -1,6 +1,7 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <string>
+#include "TextEffect.h"
 
 /**
  * @brief Handles all UI rendering for Settings Screen
@@ -52,6 +53,7 @@ private:
     // UI text elements
     sf::Text m_titleText;
     sf::Text m_backInstructionText;
+    TextEffect m_titleEffect;  // Cached title + drop shadow
 
     // Animation state
     float m_animationTime = 0.0f;
@@ -86,7 +88,6 @@ private:
 
     // Animation helpers - private implementation details
     void updateTitleGlowEffect();
-    void createShadowEffect(sf::Text& shadowText, const sf::Text& originalText, sf::Vector2f offset);
     sf::Color calculateGlowColor(float intensity) const;
     float calculateGlowIntensity() const;
 
@@ -15,6 +15,10 @@ public:
     bool handleMouseMove(sf::Vector2f mousePos);
     bool handleMousePressed(sf::Vector2f mousePos);
     bool handleMouseReleased();
+    bool isDragging() const { return m_isDragging; }
+
+    // Area that reacts to the mouse (track plus some vertical slack for the handle)
+    const sf::FloatRect& getHitBounds() const { return m_hitBounds; }
 
     void update(float deltaTime);
     void render(sf::RenderWindow& window);
@@ -24,6 +28,7 @@ public:
 private:
     sf::Vector2f m_position;
     sf::Vector2f m_size;
+    sf::FloatRect m_hitBounds;
     float m_minValue;
     float m_maxValue;
     float m_value;
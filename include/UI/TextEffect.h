@@ -0,0 +1,50 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+/**
+ * @brief Text with drop shadow and pulsing color, drawn from a cached texture
+ *
+ * The glyphs are baked once (white coverage) into a texture and only
+ * re-baked when string, font, size or style change. They are rasterized at
+ * window resolution (character size times the layout scale) and the sprite
+ * is drawn scaled back down, so the letterboxed view does not stretch a
+ * low-resolution bake; a new layout scale re-bakes. Each frame the text and
+ * its shadow are drawn in a single shader pass; without shader support the
+ * cached texture is drawn twice (shadow tint + text tint) instead of copying
+ * and re-laying out an sf::Text.
+ *
+ * Only the text position is honoured - origin, scale and rotation are ignored.
+ */
+class TextEffect {
+public:
+    TextEffect() = default;
+
+    // Copy the text to render (re-bakes on next render if the glyphs changed)
+    void setText(const sf::Text& text);
+
+    void setPosition(const sf::Vector2f& position);
+    void setFillColor(const sf::Color& color);
+    void setShadow(const sf::Color& color, const sf::Vector2f& offset);
+
+    void render(sf::RenderTarget& target);
+
+private:
+    sf::Text m_text;
+    sf::Color m_fillColor = sf::Color::White;
+    sf::Color m_shadowColor = sf::Color(0, 0, 0, 100);
+    sf::Vector2f m_shadowOffset = sf::Vector2f(3.0f, 3.0f);
+
+    // Baked glyph cache
+    sf::Texture m_texture;
+    sf::Sprite m_sprite;
+    sf::Vector2f m_bakeOrigin;     // Offset of the cache sprite relative to the text position
+    float m_bakeScale = 1.0f;      // Texture pixels per virtual unit
+    bool m_dirty = true;
+    bool m_cacheValid = false;
+
+    void bake(float scale);
+    bool glyphsDiffer(const sf::Text& other) const;
+    void renderWithShader(sf::RenderTarget& target, sf::Shader& shader);
+    void renderCached(sf::RenderTarget& target);
+    void renderUncached(sf::RenderTarget& target);
+};
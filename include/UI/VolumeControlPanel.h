@@ -4,7 +4,9 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include "Slider.h"
+#include "HitTestGrid.h"
 #include "AudioManager.h"
 #include "AudioSettingsManager.h"
 
@@ -48,10 +50,18 @@ private:
     std::unique_ptr<VolumeSlider> m_musicVolume;
     std::unique_ptr<VolumeSlider> m_sfxVolume;
 
+    // Pointer routing - grid ids index into m_sliders
+    HitTestGrid m_hitGrid;
+    std::vector<Slider*> m_sliders;
+    std::vector<HitTestGrid::WidgetId> m_hoveredSliders;
+    Slider* m_activeSlider = nullptr;     // Slider being dragged, receives moves anywhere
+
     sf::Vector2f calculateSliderPosition(int index) const;
     void setupMasterVolumeSlider(const sf::Font& font);
     void setupMusicVolumeSlider(const sf::Font& font);
     void setupSFXVolumeSlider(const sf::Font& font);
+    void buildHitGrid();
+    bool routeMouseMove(const sf::Vector2f& mousePos);
     void updateAllValueTexts();
     void onVolumeChanged(const std::string& type, float value);
     void applyVolumeToAudioManager(const std::string& type, float value);
@@ -1,5 +1,7 @@
 ﻿#include "App.h"
 #include <Logger.h>
+#include "LayoutManager.h"
+#include "SettingsRegistry.h"
 
 App::App()
     : m_windowManager(std::make_unique<WindowManager>())
@@ -36,17 +38,30 @@ void App::run() {
 void App::initialize() {
     Logger::log("Initializing application...");
 
-    // Step 1: Create and setup window
-    m_windowManager->createWindow(1400, 800, "Desert Ball");
-    m_windowManager->setFramerateLimit(60);
-    m_windowManager->setVerticalSyncEnabled(false);
+    // Step 1: Create and setup window at the design resolution (resizable - see LayoutManager)
+    m_windowManager->createWindow(
+        static_cast<unsigned int>(LayoutManager::VIRTUAL_WIDTH),
+        static_cast<unsigned int>(LayoutManager::VIRTUAL_HEIGHT),
+        "Desert Ball");
 
-    // Step 2: Initialize all game systems
+    // Step 2: Initialize all game systems (loads settings.txt)
     m_initializer->initializeAllSystems();
 
+    // Step 3: Video settings - re-applied whenever they change
+    applyVideoSettings();
+    auto& settings = SettingsRegistry::instance();
+    settings.subscribe(SettingId::VerticalSync, [this](SettingId) { applyVideoSettings(); });
+    settings.subscribe(SettingId::FramerateLimit, [this](SettingId) { applyVideoSettings(); });
+
     Logger::log("Application initialization completed");
 }
 
+void App::applyVideoSettings() {
+    const auto& settings = SettingsRegistry::instance();
+    m_windowManager->setFramerateLimit(static_cast<unsigned int>(settings.getInt(SettingId::FramerateLimit)));
+    m_windowManager->setVerticalSyncEnabled(settings.getBool(SettingId::VerticalSync));
+}
+
 void App::cleanup() {
     Logger::log("Cleaning up application...");
 
@@ -2,7 +2,8 @@
 #include "AudioManager.h"
 #include "AppContext.h"
 #include "Logger.h"
-#include <AudioSettingsManager.h>
+#include "SettingsPersistence.h"
+#include "ProfileStore.h"
 
 void AppCleanupManager::performCleanup() {
     Logger::log("Starting application cleanup...");
@@ -45,7 +46,16 @@ void AppCleanupManager::saveUserSettings() {
         settings.musicVolume = audioManager.getMusicVolume();
         settings.sfxVolume = audioManager.getSFXVolume();
 
-        AudioSettingsManager::save(settings);
+        // Last chance - write now instead of waiting for the debounce
+        SettingsPersistence::instance().submit(settings);
+        SettingsPersistence::instance().flush();
+
+        // Binary snapshot of all user state (settings, scores, unlocks)
+        auto& profile = ProfileStore::instance();
+        profile.captureSettings();
+        if (!profile.save()) {
+            Logger::log("Profile snapshot not saved", LogLevel::Warning);
+        }
 
         logCleanupOperation("User settings save", true);
     }
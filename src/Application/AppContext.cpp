@@ -19,6 +19,8 @@ AppContext::AppContext() {
     // Initialize other services
     m_screenManager = std::make_unique<ScreenManager>();
     m_commandInvoker = std::make_unique<CommandInvoker>();
+    m_layoutManager = std::make_unique<LayoutManager>();
+    m_highScores = std::make_unique<HighScoreTable>();
 }
 
 // Service accessor implementations - return dereferenced smart pointers
@@ -45,4 +47,12 @@ ScreenManager& AppContext::screenManager() {
 
 CommandInvoker& AppContext::commandInvoker() {
     return *m_commandInvoker;
+}
+
+LayoutManager& AppContext::layout() {
+    return *m_layoutManager;
+}
+
+HighScoreTable& AppContext::highScores() {
+    return *m_highScores;
 }
\ No newline at end of file
@@ -4,6 +4,8 @@ void GameInitializer::initializeAllSystems() {
     Logger::log("Starting game systems initialization...");
 
     try {
+        loadUserProfile();
+        loadHighScores();
         initializeAudioSystem();
         initializeResourceSystem();
         registerAllScreens();
@@ -16,12 +18,53 @@ void GameInitializer::initializeAllSystems() {
     }
 }
 
+void GameInitializer::loadUserProfile() {
+    switch (ProfileStore::instance().load()) {
+    case ProfileStore::LoadResult::Loaded:
+        Logger::log("Profile loaded");
+        break;
+    case ProfileStore::LoadResult::RolledBack:
+        Logger::log("Profile was damaged - restored the previous snapshot", LogLevel::Warning);
+        break;
+    case ProfileStore::LoadResult::Missing:
+        Logger::log("No profile yet - starting fresh");
+        break;
+    case ProfileStore::LoadResult::Corrupt:
+        Logger::log("Profile unreadable - starting fresh", LogLevel::Error);
+        break;
+    }
+}
+
+void GameInitializer::loadHighScores() {
+    auto& highScores = AppContext::instance().highScores();
+    const auto& snapshot = ProfileStore::instance().data().highScores;
+
+    if (highScores.load("highScore.txt")) {
+        Logger::log("Loaded " + std::to_string(highScores.entries().size()) + " high scores");
+    }
+    else if (!snapshot.empty()) {
+        highScores.assign(snapshot);
+        Logger::log("highScore.txt missing - high scores restored from profile snapshot", LogLevel::Warning);
+    }
+
+    ProfileStore::instance().data().highScores = highScores.entries();
+}
+
 void GameInitializer::initializeAudioSystem() {
     try {
         Logger::log("Initializing audio system...");
 
         AudioSettings settings;
-        if (AudioSettingsManager::load(settings)) {
+        bool loaded = SettingsPersistence::instance().load(settings);
+
+        // settings.txt lost - fall back to the copy in the profile snapshot
+        if (!loaded && ProfileStore::instance().restoreSettings()) {
+            settings = AudioSettingsManager::read();
+            loaded = true;
+            Logger::log("Settings restored from profile snapshot", LogLevel::Warning);
+        }
+
+        if (loaded) {
             AudioManager::instance().setMasterVolume(settings.masterVolume);
             AudioManager::instance().setMusicVolume(settings.musicVolume);
             AudioManager::instance().setSFXVolume(settings.sfxVolume);
@@ -46,12 +89,46 @@ void GameInitializer::initializeAudioSystem() {
 void GameInitializer::loadDefaultAudioFiles() {
     auto& audioManager = AudioManager::instance();
 
-    if (audioManager.loadMusic("loading_music", "intro.wav")) {
-        Logger::log("Loading music loaded successfully");
+    // Everything is loaded on worker threads so the first frame never waits on audio I/O.
+    // Every track is opened up front so screen switches never wait on a file open
+    const std::pair<const char*, const char*> musicTracks[] = {
+        { "loading_music", "intro.wav" },
+        { "desert_wind",   "desert-wind.wav" },
+        { "play_music",    "play_music.wav" },
+    };
+
+    for (const auto& [name, file] : musicTracks) {
+        audioManager.loadMusicAsync(name, file);
     }
-    else {
-        Logger::log("Warning: Could not load  music", LogLevel::Warning);
+
+    // Gameplay sound effects - rapid ones (coins, jumps) may overlap up to their instance limit.
+    // The falcon is heard from where it flies, so it is kept mono.
+    struct SoundEntry {
+        const char* name;
+        const char* file;
+        SoundOptions options;
+    };
+
+    const SoundEntry soundEffects[] = {
+        { "coin",           "coin-received.wav",  { 0, 6, 0.8f } },
+        { "jump",           "jump.wav",           { 1, 3, 1.0f } },
+        { "kill_enemy",     "kill-enemy.wav",     { 2, 3, 1.0f } },
+        { "open_box",       "open-box.wav",       { 1, 2, 1.0f } },
+        { "falcon",         "falcon.wav",         { .priority = 1, .maxInstances = 2, .gain = 0.9f, .positional = true } },
+        { "lost_life",      "lost-life.wav",      { 3, 1, 1.0f } },
+        { "level_complete", "level-complete.wav", { 4, 1, 1.0f } },
+        { "win",            "win.wav",            { 4, 1, 1.0f } },
+        { "game_over",      "GameOver.wav",       { 4, 1, 1.0f } },
+    };
+
+    for (const auto& entry : soundEffects) {
+        audioManager.loadSoundAsync(entry.name, entry.file, entry.options);
     }
+
+    // Important cues (lost life, level end) must not be cut off by a burst of coins
+    audioManager.setVoiceStealPolicy(VoiceStealPolicy::LowestPriority);
+    Logger::log("Queued " + std::to_string(std::size(musicTracks)) + " music tracks and "
+        + std::to_string(std::size(soundEffects)) + " sound effects for background loading");
 }
 
 void GameInitializer::setDefaultAudioVolumes() {
@@ -60,7 +137,8 @@ void GameInitializer::setDefaultAudioVolumes() {
     settings.musicVolume = AudioManager::instance().getMusicVolume();
     settings.sfxVolume = AudioManager::instance().getSFXVolume();
 
-    AudioSettingsManager::save(settings);
+    // Only reaches the disk when settings.txt is missing or differs
+    SettingsPersistence::instance().submit(settings);
     Logger::log("Set default audio volumes");
 }
 
@@ -84,6 +162,7 @@ void GameInitializer::registerAllScreens() {
     try {
         Logger::log("Registering all screens...");
         registerScreenFactories();
+        registerScreenMusic();
         AppContext::instance().screenManager().changeScreen(ScreenType::LOADING);
         Logger::log("All screens registered successfully");
     }
@@ -93,6 +172,26 @@ void GameInitializer::registerAllScreens() {
     }
 }
 
+void GameInitializer::registerScreenMusic() {
+    // One track loops, several form a playlist. Screens sharing a track keep it
+    // playing across the switch instead of restarting it.
+    static const std::unordered_map<ScreenType, std::vector<std::string>> screenMusic = {
+        { ScreenType::LOADING,  { "loading_music" } },
+        { ScreenType::MENU,     { "desert_wind" } },
+        { ScreenType::SETTINGS, { "desert_wind" } },
+        { ScreenType::HELP,     { "desert_wind" } },
+        { ScreenType::ABOUT_US, { "desert_wind" } },
+        { ScreenType::PLAY,     { "play_music", "desert_wind" } },
+    };
+
+    AppContext::instance().screenManager().setOnScreenChanged([](ScreenType type) {
+        auto it = screenMusic.find(type);
+        if (it != screenMusic.end()) {
+            AudioManager::instance().playPlaylist(it->second);
+        }
+    });
+}
+
 void GameInitializer::registerScreenFactories() {
     auto& screenManager = AppContext::instance().screenManager();
 
@@ -104,6 +203,10 @@ void GameInitializer::registerScreenFactories() {
         return std::make_unique<MenuScreen>();
         });
 
+    screenManager.registerScreen(ScreenType::PLAY, []() {
+        return std::make_unique<PlayScreen>();
+        });
+
     screenManager.registerScreen(ScreenType::SETTINGS, []() {
         return std::make_unique<SettingsScreen>();
         });
@@ -115,6 +218,14 @@ void GameInitializer::registerScreenFactories() {
     screenManager.registerScreen(ScreenType::ABOUT_US, []() {
         return std::make_unique<AboutScreen>();
         });
+
+    screenManager.registerScreen(ScreenType::GAMEOVER, []() {
+        return std::make_unique<GameOverScreen>();
+        });
+
+    screenManager.registerScreen(ScreenType::WINNING, []() {
+        return std::make_unique<WinningScreen>();
+        });
 }
 
 void GameInitializer::handleInitializationError(const std::string& system, const std::string& error) {
@@ -2,6 +2,8 @@
 #include "WindowManager.h"
 #include "AppContext.h"
 #include "Logger.h"
+#include "LatencyTracker.h"
+#include "AudioManager.h"
 
 GameLoop::GameLoop(WindowManager& windowManager)
     : m_windowManager(windowManager) {
@@ -21,12 +23,24 @@ void GameLoop::run() {
         throw;
     }
 
+    reportLatency();
     Logger::log("Game loop ended");
 }
 
 void GameLoop::processFrame() {
     float deltaTime = calculateDeltaTime();
 
+    // Swap screens requested last frame before any input reaches them
+    AppContext::instance().screenManager().applyPendingScreenChange();
+
+    // Single input stage: poll, coalesce and dispatch to the active screen
+    processInput();
+    if (!m_windowManager.isWindowOpen()) {
+        return;
+    }
+
+    m_profilerOverlay.update(deltaTime, m_inputQueue.getPolledCount(), m_inputQueue.getQueuedCount());
+
     // Update game logic
     updateGame(deltaTime);
 
@@ -34,15 +48,92 @@ void GameLoop::processFrame() {
     renderGame();
 }
 
+void GameLoop::processInput() {
+    auto& window = m_windowManager.getWindow();
+    auto& context = AppContext::instance();
+    auto& screenManager = context.screenManager();
+
+    try {
+        m_inputQueue.poll(window);
+
+        // System events first - a close request skips the rest of the frame's input
+        for (const auto& input : m_inputQueue.systemEvents()) {
+            handleSystemEvent(input);
+            if (!window.isOpen()) {
+                return;
+            }
+        }
+
+        // Keep the virtual-resolution view in sync with the window (recomputed only on resize)
+        updateLayout();
+        m_inputQueue.mapToVirtual(window, context.layout());
+
+        auto& latency = LatencyTracker::instance();
+        for (const auto& input : m_inputQueue.events()) {
+            if (handleDebugKey(input)) {
+                continue;
+            }
+
+            // State changes tagged during dispatch are attributed to this input's poll time
+            latency.beginDispatch(input);
+            screenManager.dispatchInput(input);
+            latency.endDispatch();
+
+            // Later events go to the screen the previous one switched to
+            screenManager.applyPendingScreenChange();
+        }
+
+        if (screenManager.isQuitRequested()) {
+            m_windowManager.closeWindow();
+        }
+    }
+    catch (const std::exception& e) {
+        Logger::log("Input error: " + std::string(e.what()), LogLevel::Error);
+        // Continue running - don't crash on input errors
+    }
+}
+
+void GameLoop::handleSystemEvent(const InputEvent& input) {
+    if (input.event.type == sf::Event::Closed) {
+        Logger::log("Window close requested");
+        m_windowManager.closeWindow();
+        return;
+    }
+
+    // Screens may still react to resize/focus changes
+    AppContext::instance().screenManager().dispatchInput(input);
+}
+
+bool GameLoop::handleDebugKey(const InputEvent& input) {
+    if (input.event.type != sf::Event::KeyPressed) {
+        return false;
+    }
+
+    switch (input.event.key.code) {
+    case sf::Keyboard::F3:
+        m_profilerOverlay.toggle();
+        return true;
+
+    case sf::Keyboard::F4: {
+        auto& latency = LatencyTracker::instance();
+        latency.setEnabled(!latency.isEnabled());
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
 void GameLoop::updateGame(float deltaTime) {
     try {
         auto& screenManager = AppContext::instance().screenManager();
 
-        // Handle events first
-        screenManager.handleEvents(m_windowManager.getWindow());
-
         // Update current screen
         screenManager.update(deltaTime);
+
+        // Music fades and playlists advance on the frame tick
+        AudioManager::instance().update(deltaTime);
     }
     catch (const std::exception& e) {
         Logger::log("Update error: " + std::string(e.what()), LogLevel::Error);
@@ -60,9 +151,11 @@ void GameLoop::renderGame() {
 
         // Render current screen
         screenManager.render(window);
+        m_profilerOverlay.render(window);
 
-        // Display frame
+        // Display frame - tagged input is considered visible once display() returns
         window.display();
+        LatencyTracker::instance().onFramePresented();
     }
     catch (const std::exception& e) {
         Logger::log("Render error: " + std::string(e.what()), LogLevel::Error);
@@ -70,6 +163,29 @@ void GameLoop::renderGame() {
     }
 }
 
+void GameLoop::updateLayout() {
+    auto& window = m_windowManager.getWindow();
+    auto& layout = AppContext::instance().layout();
+
+    if (layout.updateForWindow(window.getSize())) {
+        Logger::log("Layout recalculated for window size " +
+            std::to_string(window.getSize().x) + "x" + std::to_string(window.getSize().y));
+    }
+
+    layout.apply(window);
+}
+
+void GameLoop::reportLatency() const {
+    const auto& latency = LatencyTracker::instance();
+    if (latency.getOverall().getCount() == 0) {
+        return;
+    }
+
+    // Benchmark output: summary in the log, full histograms in a report file
+    Logger::log(latency.formatReport());
+    latency.writeReport(LATENCY_REPORT_PATH);
+}
+
 float GameLoop::calculateDeltaTime() {
     float deltaTime = m_clock.restart().asSeconds();
 
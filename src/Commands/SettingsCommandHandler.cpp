@@ -97,6 +97,19 @@ bool SettingsCommandHandler::handleKeyboardInput(const sf::Event& event) {
     }
 }
 
+void SettingsCommandHandler::update() {
+    if (m_isDestroying || !m_autoSaveManager) {
+        return;
+    }
+
+    try {
+        m_autoSaveManager->update();
+    }
+    catch (const std::exception& e) {
+        std::cout << "SettingsCommandHandler: Error in auto-save: " << e.what() << std::endl;
+    }
+}
+
 void SettingsCommandHandler::setVolumePanel(std::shared_ptr<VolumeControlPanel> panel) {
     if (m_isDestroying || !m_autoSaveManager) {
         return;
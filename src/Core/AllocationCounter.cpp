@@ -0,0 +1,96 @@
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    thread_local std::uint64_t t_threadCount = 0;
+    std::atomic<std::uint64_t> g_totalCount{ 0 };
+
+    void countAllocation() {
+        ++t_threadCount;
+        g_totalCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void* allocate(std::size_t size) {
+        countAllocation();
+        return std::malloc(size ? size : 1);
+    }
+
+    void* allocateAligned(std::size_t size, std::align_val_t alignment) {
+        countAllocation();
+        std::size_t align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+        return _aligned_malloc(size ? size : 1, align);
+#else
+        // aligned_alloc wants the size to be a multiple of the alignment
+        std::size_t rounded = ((size ? size : 1) + align - 1) / align * align;
+        return std::aligned_alloc(align, rounded);
+#endif
+    }
+
+    void freeAligned(void* pointer) {
+#ifdef _WIN32
+        _aligned_free(pointer);
+#else
+        std::free(pointer);
+#endif
+    }
+}
+
+std::uint64_t AllocationCounter::getThreadCount() {
+    return t_threadCount;
+}
+
+std::uint64_t AllocationCounter::getTotalCount() {
+    return g_totalCount.load(std::memory_order_relaxed);
+}
+
+// Replacement global allocation functions - the array and nothrow forms of
+// the standard library forward to these
+
+void* operator new(std::size_t size) {
+    if (void* pointer = allocate(size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* pointer = allocateAligned(size, alignment)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocateAligned(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    freeAligned(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+    freeAligned(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    freeAligned(pointer);
+}
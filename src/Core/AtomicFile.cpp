@@ -0,0 +1,25 @@
+#include "AtomicFile.h"
+#include "Logger.h"
+#include <filesystem>
+#include <fstream>
+
+bool AtomicFile::write(const std::string& path, std::string_view contents) {
+    const std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open() || !file.write(contents.data(), static_cast<std::streamsize>(contents.size()))) {
+            Logger::log("Failed to write " + tempPath, LogLevel::Error);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error) {
+        Logger::log("Failed to replace " + path + ": " + error.message(), LogLevel::Error);
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,37 @@
+#include "AudioBus.h"
+#include <algorithm>
+
+AudioBusGraph::AudioBusGraph() {
+    bus(AudioBusId::Music).parent = AudioBusId::Master;
+    bus(AudioBusId::Sfx).parent = AudioBusId::Master;
+    bus(AudioBusId::Ui).parent = AudioBusId::Master;
+}
+
+void AudioBusGraph::setVolume(AudioBusId id, float volume) {
+    volume = std::clamp(volume, 0.0f, 100.0f);
+    if (bus(id).volume == volume) {
+        return;
+    }
+
+    bus(id).volume = volume;
+    ++m_generation;
+}
+
+float AudioBusGraph::getVolume(AudioBusId id) const {
+    return bus(id).volume;
+}
+
+float AudioBusGraph::getEffectiveGain(AudioBusId id) const {
+    const Bus& node = bus(id);
+    if (node.cachedGeneration != m_generation) {
+        float gain = node.volume / 100.0f;
+        if (node.parent != AudioBusId::Count) {
+            gain *= getEffectiveGain(node.parent);
+        }
+
+        node.cachedGain = gain;
+        node.cachedGeneration = m_generation;
+    }
+
+    return node.cachedGain;
+}
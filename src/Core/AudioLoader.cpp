@@ -0,0 +1,95 @@
+#include "AudioLoader.h"
+#include <algorithm>
+#include <iterator>
+
+AudioLoader::AudioLoader(std::size_t workerCount)
+    : m_workerCount(std::max<std::size_t>(1, workerCount)) {
+}
+
+AudioLoader::~AudioLoader() {
+    // Jobs still queued are dropped; a worker mid-decode finishes that file first
+    for (auto& worker : m_workers) {
+        worker.request_stop();
+    }
+    m_jobReady.notify_all();
+}
+
+void AudioLoader::request(Kind kind, const std::string& name, const std::string& filePath) {
+    {
+        std::lock_guard lock(m_mutex);
+        m_jobs.push_back({ kind, name, filePath });
+        ++m_pending;
+    }
+
+    if (m_workers.empty()) {
+        for (std::size_t i = 0; i < m_workerCount; ++i) {
+            m_workers.emplace_back([this](std::stop_token stopToken) { workerLoop(stopToken); });
+        }
+    }
+
+    m_jobReady.notify_one();
+}
+
+void AudioLoader::collect(std::vector<Result>& results) {
+    std::lock_guard lock(m_mutex);
+    if (m_results.empty()) {
+        return;
+    }
+
+    m_pending -= m_results.size();
+    std::move(m_results.begin(), m_results.end(), std::back_inserter(results));
+    m_results.clear();
+}
+
+std::size_t AudioLoader::getPendingCount() const {
+    std::lock_guard lock(m_mutex);
+    return m_pending;
+}
+
+std::size_t AudioLoader::defaultWorkerCount() {
+    // Loading is mostly file I/O plus decoding - a couple of threads saturate it
+    // without competing with the render thread
+    unsigned int hardware = std::thread::hardware_concurrency();
+    return std::clamp<std::size_t>(hardware > 2 ? hardware - 2 : 1, 1, 2);
+}
+
+void AudioLoader::workerLoop(std::stop_token stopToken) {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock lock(m_mutex);
+            if (!m_jobReady.wait(lock, stopToken, [this] { return !m_jobs.empty(); })) {
+                return; // Stop requested
+            }
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        Result result = load(job);
+
+        std::lock_guard lock(m_mutex);
+        m_results.push_back(std::move(result));
+    }
+}
+
+AudioLoader::Result AudioLoader::load(const Job& job) {
+    Result result;
+    result.kind = job.kind;
+    result.name = job.name;
+    result.filePath = job.filePath;
+
+    if (job.kind == Kind::Sound) {
+        auto buffer = std::make_unique<sf::SoundBuffer>();
+        if (buffer->loadFromFile(job.filePath)) {
+            result.buffer = std::move(buffer);
+        }
+    }
+    else {
+        auto music = std::make_unique<sf::Music>();
+        if (music->openFromFile(job.filePath)) {
+            result.music = std::move(music);
+        }
+    }
+
+    return result;
+}
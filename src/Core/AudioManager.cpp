@@ -1,115 +1,507 @@
 ﻿#include "../Core/AudioManager.h"
 #include <iostream>
 #include <algorithm>
+#include <filesystem>
 
 AudioManager& AudioManager::instance() {
     static AudioManager instance;
     return instance;
 }
 
-AudioManager::AudioManager()
-    : m_masterVolume(100.0f), m_musicVolume(100.0f), m_sfxVolume(100.0f) {
+AudioManager::AudioManager() {
+    applyBusChanges();
 }
 
 void AudioManager::setMasterVolume(float volume) {
-    m_masterVolume = std::clamp(volume, 0.0f, 100.0f);
-    updateMusicVolume();
-    updateSFXVolume();
+    m_buses.setVolume(AudioBusId::Master, volume);
 }
 
 void AudioManager::setMusicVolume(float volume) {
-    m_musicVolume = std::clamp(volume, 0.0f, 100.0f);
-    updateMusicVolume();
+    m_buses.setVolume(AudioBusId::Music, volume);
 }
 
 void AudioManager::setSFXVolume(float volume) {
-    m_sfxVolume = std::clamp(volume, 0.0f, 100.0f);
-    updateSFXVolume();
+    m_buses.setVolume(AudioBusId::Sfx, volume);
+}
+
+void AudioManager::setBusVolume(AudioBusId bus, float volume) {
+    m_buses.setVolume(bus, volume);
 }
 
 float AudioManager::getMasterVolume() const {
-    return m_masterVolume;
+    return m_buses.getVolume(AudioBusId::Master);
 }
 
 float AudioManager::getMusicVolume() const {
-    return m_musicVolume;
+    return m_buses.getVolume(AudioBusId::Music);
 }
 
 float AudioManager::getSFXVolume() const {
-    return m_sfxVolume;
+    return m_buses.getVolume(AudioBusId::Sfx);
+}
+
+float AudioManager::getBusVolume(AudioBusId bus) const {
+    return m_buses.getVolume(bus);
 }
 
 bool AudioManager::loadMusic(const std::string& name, const std::string& filePath) {
-    auto music = std::make_unique<sf::Music>();
-    if (!music->openFromFile(filePath)) {
+    // Streamed from disk - only the decode buffers stay resident
+    if (!m_musicPlayer.load(name, resolveAudioPath(filePath))) {
         std::cerr << "Failed to load music: " << filePath << std::endl;
         return false;
     }
-    m_music[name] = std::move(music);
     return true;
 }
 
-void AudioManager::playMusic(const std::string& name, bool loop) {
-    auto it = m_music.find(name);
-    if (it != m_music.end()) {
-        if (m_currentMusic) m_currentMusic->stop();
-        m_currentMusic = it->second.get();
-        m_currentMusic->setLoop(loop);
-        m_currentMusic->setVolume(getEffectiveVolume(m_musicVolume));
-        m_currentMusic->play();
+void AudioManager::loadMusicAsync(const std::string& name, const std::string& filePath) {
+    m_loadingMusic.insert(name);
+    m_loader.request(AudioLoader::Kind::Music, name, resolveAudioPath(filePath));
+}
+
+void AudioManager::playMusic(const std::string& name, bool loop, float fadeSeconds) {
+    if (m_loadingMusic.count(name)) {
+        m_musicRequest = { { name }, loop, fadeSeconds, false, true };
+        return;
     }
+
+    m_musicRequest.active = false;
+    m_musicPlayer.play(name, loop, fadeSeconds);
 }
 
-void AudioManager::stopMusic() {
-    if (m_currentMusic) m_currentMusic->stop();
-    m_currentMusic = nullptr;
+void AudioManager::playPlaylist(const std::vector<std::string>& tracks, bool repeat, float fadeSeconds) {
+    if (isMusicLoading(tracks)) {
+        m_musicRequest = { tracks, repeat, fadeSeconds, true, true };
+        return;
+    }
+
+    m_musicRequest.active = false;
+    m_musicPlayer.playPlaylist(tracks, repeat, fadeSeconds);
+}
+
+void AudioManager::stopMusic(float fadeSeconds) {
+    m_musicRequest.active = false;
+    m_musicPlayer.stop(fadeSeconds);
 }
 
 void AudioManager::pauseMusic() {
-    if (m_currentMusic) m_currentMusic->pause();
+    m_musicPlayer.pause();
 }
 
 void AudioManager::resumeMusic() {
-    if (m_currentMusic) m_currentMusic->play();
+    m_musicPlayer.resume();
+}
+
+void AudioManager::update(float deltaTime) {
+    processLoadResults();
+    applyBusChanges();
+    updatePositionalVoices();
+    m_musicPlayer.update(deltaTime);
 }
 
-bool AudioManager::loadSound(const std::string& name, const std::string& filePath) {
-    if (!m_soundBuffers[name].loadFromFile(filePath)) {
+bool AudioManager::loadSound(const std::string& name, const std::string& filePath, const SoundOptions& options) {
+    // Decoded once into memory - compressed on disk, PCM while loaded
+    auto buffer = std::make_unique<sf::SoundBuffer>();
+    if (!buffer->loadFromFile(resolveAudioPath(filePath))) {
         std::cerr << "Failed to load sound: " << filePath << std::endl;
         return false;
     }
-    m_sounds[name].setBuffer(m_soundBuffers[name]);
+
+    registerSound(name, options);
+    installBuffer(name, std::move(buffer));
     return true;
 }
 
+SoundId AudioManager::loadSoundAsync(const std::string& name, const std::string& filePath, const SoundOptions& options) {
+    SoundId id = registerSound(name, options);
+    m_soundDefinitions[id].loading = true;
+    m_loader.request(AudioLoader::Kind::Sound, name, resolveAudioPath(filePath));
+    return id;
+}
+
+SoundId AudioManager::registerSound(const std::string& name, const SoundOptions& options) {
+    auto it = m_soundIds.find(name);
+    if (it == m_soundIds.end()) {
+        it = m_soundIds.emplace(name, m_soundDefinitions.size()).first;
+        m_soundDefinitions.emplace_back();
+    }
+
+    SoundDefinition& definition = m_soundDefinitions[it->second];
+    definition.options = options;
+    definition.options.maxInstances = std::max(1u, options.maxInstances);
+    return it->second;
+}
+
+void AudioManager::installBuffer(const std::string& name, std::unique_ptr<sf::SoundBuffer> buffer) {
+    SoundDefinition& definition = m_soundDefinitions[m_soundIds.at(name)];
+    if (definition.options.positional && buffer->getChannelCount() > 1) {
+        downmixToMono(*buffer);
+    }
+
+    // Replacing a buffer detaches the voices still playing the old one
+    auto& slot = m_soundBuffers[name];
+    slot = std::move(buffer);
+    definition.buffer = slot.get();
+}
+
+void AudioManager::downmixToMono(sf::SoundBuffer& buffer) {
+    const unsigned int channels = buffer.getChannelCount();
+    const sf::Int16* samples = buffer.getSamples();
+    const std::size_t frames = static_cast<std::size_t>(buffer.getSampleCount() / channels);
+
+    std::vector<sf::Int16> mono(frames);
+    for (std::size_t frame = 0; frame < frames; ++frame) {
+        int sum = 0;
+        for (unsigned int channel = 0; channel < channels; ++channel) {
+            sum += samples[frame * channels + channel];
+        }
+        mono[frame] = static_cast<sf::Int16>(sum / static_cast<int>(channels));
+    }
+
+    if (!buffer.loadFromSamples(mono.data(), mono.size(), 1, buffer.getSampleRate())) {
+        std::cerr << "Failed to downmix sound to mono" << std::endl;
+    }
+}
+
+void AudioManager::processLoadResults() {
+    m_loader.collect(m_loadResults);
+    if (m_loadResults.empty()) {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    for (auto& result : m_loadResults) {
+        if (result.kind == AudioLoader::Kind::Music) {
+            m_loadingMusic.erase(result.name);
+            if (!m_musicPlayer.adopt(result.name, std::move(result.music))) {
+                std::cerr << "Failed to load music: " << result.filePath << std::endl;
+            }
+            continue;
+        }
+
+        SoundId id = getSoundId(result.name);
+        SoundDefinition& definition = m_soundDefinitions[id];
+        definition.loading = false;
+
+        if (result.buffer) {
+            installBuffer(result.name, std::move(result.buffer));
+        }
+        else {
+            std::cerr << "Failed to load sound: " << result.filePath << std::endl;
+        }
+
+        if (definition.playQueued) {
+            definition.playQueued = false;
+            std::chrono::duration<float> waited = now - definition.queuedAt;
+            if (definition.buffer && waited.count() <= MAX_QUEUED_PLAY_DELAY) {
+                playSound(id, definition.queuedGain, definition.queuedPitch);
+            }
+        }
+    }
+    m_loadResults.clear();
+
+    // Start the music that was asked for while its tracks were opening
+    if (m_musicRequest.active && !isMusicLoading(m_musicRequest.tracks)) {
+        MusicRequest request = std::move(m_musicRequest);
+        m_musicRequest = MusicRequest();
+        if (request.isPlaylist) {
+            playPlaylist(request.tracks, request.loop, request.fadeSeconds);
+        }
+        else {
+            playMusic(request.tracks.front(), request.loop, request.fadeSeconds);
+        }
+    }
+}
+
+bool AudioManager::isMusicLoading(const std::vector<std::string>& tracks) const {
+    return std::any_of(tracks.begin(), tracks.end(),
+        [this](const std::string& track) { return m_loadingMusic.count(track) != 0; });
+}
+
+std::string AudioManager::resolveAudioPath(const std::string& filePath) {
+    namespace fs = std::filesystem;
+
+    std::error_code error;
+    for (const char* extension : { ".ogg", ".flac" }) {
+        fs::path cooked = fs::path(filePath).replace_extension(extension);
+        if (fs::exists(cooked, error)) {
+            return cooked.string();
+        }
+    }
+
+    return filePath;
+}
+
+SoundId AudioManager::getSoundId(const std::string& name) const {
+    auto it = m_soundIds.find(name);
+    return it != m_soundIds.end() ? it->second : INVALID_SOUND;
+}
+
 void AudioManager::playSound(const std::string& name) {
-    auto it = m_sounds.find(name);
-    if (it != m_sounds.end()) {
-        it->second.setVolume(getEffectiveVolume(m_sfxVolume));
-        it->second.play();
+    playSound(getSoundId(name));
+}
+
+void AudioManager::playSound(SoundId id, float gain, float pitch) {
+    Voice* voice = startVoice(id, gain, pitch, true);
+    if (!voice) {
+        return;
     }
+
+    // Voices are shared with positional playback - pin this one to the listener
+    voice->positional = false;
+    voice->sound.setRelativeToListener(true);
+    voice->sound.setPosition(0.0f, 0.0f, 0.0f);
+    voice->sound.play();
 }
 
-void AudioManager::updateMusicVolume() {
-    if (m_currentMusic) {
-        m_currentMusic->setVolume(getEffectiveVolume(m_musicVolume));
+VoiceHandle AudioManager::playSoundAt(SoundId id, sf::Vector2f position, float gain, float pitch) {
+    if (id >= m_soundDefinitions.size()) {
+        return {};
     }
-    for (auto& [name, music] : m_music) {
-        if (music->getStatus() == sf::Music::Playing) {
-            music->setVolume(getEffectiveVolume(m_musicVolume));
+
+    // Inaudible - do not spend a voice on it
+    SoundDefinition& definition = m_soundDefinitions[id];
+    const SoundOptions& options = definition.options;
+    if (isOutOfRange(position, options.maxDistance)) {
+        return {};
+    }
+
+    // A stereo buffer would play unattenuated at the listener - convert it once
+    if (definition.buffer && definition.buffer->getChannelCount() > 1) {
+        std::cerr << "Sound " << id << " played positionally but not loaded as positional - downmixing" << std::endl;
+        for (auto& [name, buffer] : m_soundBuffers) {
+            if (buffer.get() == definition.buffer) {
+                downmixToMono(*buffer);
+                break;
+            }
         }
     }
+
+    Voice* voice = startVoice(id, gain, pitch, false);
+    if (!voice) {
+        return {};
+    }
+
+    voice->positional = true;
+    voice->positionDirty = false;
+    voice->position = position;
+    voice->maxDistance = options.maxDistance;
+
+    voice->sound.setRelativeToListener(false);
+    voice->sound.setPosition(position.x, position.y, 0.0f);
+    voice->sound.setMinDistance(options.minDistance);
+    voice->sound.setAttenuation(options.attenuation);
+    voice->sound.play();
+
+    return { static_cast<std::uint32_t>(voice - m_voices.data()), voice->startOrder };
 }
 
-void AudioManager::updateSFXVolume() {
-    for (auto& [name, sound] : m_sounds) {
-        sound.setVolume(getEffectiveVolume(m_sfxVolume));
+void AudioManager::setVoicePosition(VoiceHandle handle, sf::Vector2f position) {
+    if (Voice* voice = resolve(handle)) {
+        voice->position = position;
+        voice->positionDirty = true;
+        m_positionsDirty = true;
+    }
+}
+
+void AudioManager::stopVoice(VoiceHandle handle) {
+    if (Voice* voice = resolve(handle)) {
+        voice->sound.stop();
+        voice->soundId = INVALID_SOUND;
+    }
+}
+
+bool AudioManager::isVoicePlaying(VoiceHandle handle) const {
+    if (handle.index >= MAX_VOICES) {
+        return false;
+    }
+
+    const Voice& voice = m_voices[handle.index];
+    return voice.startOrder == handle.startOrder && voice.isActive();
+}
+
+void AudioManager::setListenerPosition(sf::Vector2f position) {
+    if (position != m_listenerPosition) {
+        m_listenerPosition = position;
+        m_listenerDirty = true;
+    }
+}
+
+AudioManager::Voice* AudioManager::startVoice(SoundId id, float gain, float pitch, bool queueWhileLoading) {
+    if (id >= m_soundDefinitions.size()) {
+        return nullptr;
+    }
+
+    SoundDefinition& definition = m_soundDefinitions[id];
+    if (!definition.buffer) {
+        if (definition.loading && queueWhileLoading) {
+            definition.playQueued = true;
+            definition.queuedGain = gain;
+            definition.queuedPitch = pitch;
+            definition.queuedAt = std::chrono::steady_clock::now();
+        }
+        return nullptr;
+    }
+
+    Voice* voice = acquireVoice(id, definition.options);
+    if (!voice) {
+        return nullptr; // Pool full of more important sounds
+    }
+
+    voice->sound.stop();
+    if (voice->sound.getBuffer() != definition.buffer) {
+        voice->sound.setBuffer(*definition.buffer);
+    }
+
+    voice->soundId = id;
+    voice->startOrder = m_nextStartOrder++;
+    voice->priority = definition.options.priority;
+    voice->gain = std::clamp(definition.options.gain * gain, 0.0f, 1.0f);
+    voice->bus = definition.options.bus;
+
+    voice->sound.setPitch(pitch);
+    voice->sound.setVolume(100.0f * m_buses.getEffectiveGain(voice->bus) * voice->gain);
+    return voice;
+}
+
+AudioManager::Voice* AudioManager::resolve(VoiceHandle handle) {
+    if (handle.index >= MAX_VOICES) {
+        return nullptr;
+    }
+
+    Voice& voice = m_voices[handle.index];
+    return (voice.startOrder == handle.startOrder && voice.isActive()) ? &voice : nullptr;
+}
+
+bool AudioManager::isOutOfRange(sf::Vector2f position, float maxDistance) const {
+    float dx = position.x - m_listenerPosition.x;
+    float dy = position.y - m_listenerPosition.y;
+    return dx * dx + dy * dy > maxDistance * maxDistance;
+}
+
+void AudioManager::updatePositionalVoices() {
+    if (!m_listenerDirty && !m_positionsDirty) {
+        return;
+    }
+
+    if (m_listenerDirty) {
+        sf::Listener::setPosition(m_listenerPosition.x, m_listenerPosition.y, 0.0f);
+    }
+
+    for (auto& voice : m_voices) {
+        if (!voice.positional || !voice.isActive()) {
+            continue;
+        }
+        if (!m_listenerDirty && !voice.positionDirty) {
+            continue;
+        }
+
+        if (voice.positionDirty) {
+            voice.sound.setPosition(voice.position.x, voice.position.y, 0.0f);
+            voice.positionDirty = false;
+        }
+
+        if (isOutOfRange(voice.position, voice.maxDistance)) {
+            voice.sound.stop();
+            voice.soundId = INVALID_SOUND;
+        }
+    }
+
+    m_listenerDirty = false;
+    m_positionsDirty = false;
+}
+
+AudioManager::Voice* AudioManager::acquireVoice(SoundId id, const SoundOptions& options) {
+    // Single pass: count instances of this sound, remember its oldest voice and a free voice
+    Voice* freeVoice = nullptr;
+    Voice* oldestInstance = nullptr;
+    unsigned int instances = 0;
+
+    for (auto& voice : m_voices) {
+        if (!voice.isActive()) {
+            if (!freeVoice) freeVoice = &voice;
+            continue;
+        }
+
+        if (voice.soundId == id) {
+            ++instances;
+            if (!oldestInstance || voice.startOrder < oldestInstance->startOrder) {
+                oldestInstance = &voice;
+            }
+        }
+    }
+
+    // Per-sound limit: restart the oldest instance instead of taking another voice
+    if (instances >= options.maxInstances) {
+        return oldestInstance;
+    }
+
+    return freeVoice ? freeVoice : chooseVictim(options.priority);
+}
+
+AudioManager::Voice* AudioManager::chooseVictim(int incomingPriority) {
+    Voice* victim = nullptr;
+
+    for (auto& voice : m_voices) {
+        if (!victim) {
+            victim = &voice;
+            continue;
+        }
+
+        switch (m_stealPolicy) {
+        case VoiceStealPolicy::Oldest:
+            if (voice.startOrder < victim->startOrder) victim = &voice;
+            break;
+
+        case VoiceStealPolicy::Quietest:
+            if (voice.gain < victim->gain ||
+                (voice.gain == victim->gain && voice.startOrder < victim->startOrder)) {
+                victim = &voice;
+            }
+            break;
+
+        case VoiceStealPolicy::LowestPriority:
+            if (voice.priority < victim->priority ||
+                (voice.priority == victim->priority && voice.startOrder < victim->startOrder)) {
+                victim = &voice;
+            }
+            break;
+
+        case VoiceStealPolicy::None:
+            return nullptr;
+        }
+    }
+
+    if (m_stealPolicy == VoiceStealPolicy::LowestPriority && victim && victim->priority > incomingPriority) {
+        return nullptr;
+    }
+
+    return victim;
+}
+
+std::size_t AudioManager::getActiveVoiceCount() const {
+    return static_cast<std::size_t>(std::count_if(m_voices.begin(), m_voices.end(),
+        [](const Voice& voice) { return voice.isActive(); }));
+}
+
+void AudioManager::applyBusChanges() {
+    if (m_appliedBusGeneration == m_buses.getGeneration()) {
+        return;
+    }
+    m_appliedBusGeneration = m_buses.getGeneration();
+
+    m_musicPlayer.setVolume(100.0f * m_buses.getEffectiveGain(AudioBusId::Music));
+
+    for (auto& voice : m_voices) {
+        if (voice.isActive()) {
+            voice.sound.setVolume(100.0f * m_buses.getEffectiveGain(voice.bus) * voice.gain);
+        }
     }
 }
 
 void AudioManager::stopAllSounds() {
-    for (auto& [name, sound] : m_sounds) {
-        sound.stop();
+    for (auto& voice : m_voices) {
+        voice.sound.stop();
+        voice.soundId = INVALID_SOUND;
     }
     stopMusic();
 }
@@ -119,7 +511,3 @@ void AudioManager::resetAudioSystem() {
     setMusicVolume(100.0f);
     setSFXVolume(100.0f);
 }
-
-float AudioManager::getEffectiveVolume(float baseVolume) const {
-    return (baseVolume / 100.0f) * (m_masterVolume / 100.0f) * 100.0f;
-}
@@ -0,0 +1,126 @@
+#include "HighScoreTable.h"
+#include "AtomicFile.h"
+#include "Logger.h"
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+
+namespace {
+    std::string_view trimLine(std::string_view line) {
+        while (!line.empty() && (line.back() == '\r' || line.back() == ' ' || line.back() == '\t')) line.remove_suffix(1);
+        while (!line.empty() && (line.front() == ' ' || line.front() == '\t')) line.remove_prefix(1);
+        return line;
+    }
+}
+
+HighScoreTable::HighScoreTable(std::size_t capacity)
+    : m_capacity(std::max<std::size_t>(1, capacity)) {
+    m_entries.reserve(m_capacity + 1);
+}
+
+bool HighScoreTable::load(const std::string& path) {
+    m_path = path;
+    m_entries.clear();
+    m_lastRank.reset();
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::string_view remaining = text;
+    std::optional<std::string_view> pendingName;
+
+    while (!remaining.empty()) {
+        std::size_t end = remaining.find('\n');
+        std::string_view line = trimLine(remaining.substr(0, end));
+        remaining = (end == std::string_view::npos) ? std::string_view() : remaining.substr(end + 1);
+
+        if (line.empty()) {
+            continue;
+        }
+
+        if (!pendingName) {
+            pendingName = line;
+            continue;
+        }
+
+        int score = 0;
+        auto [ptr, error] = std::from_chars(line.data(), line.data() + line.size(), score);
+        if (error != std::errc() || ptr != line.data() + line.size()) {
+            // Not a score - treat this line as the next name and drop the orphan
+            Logger::log("highScore.txt: no score for '" + std::string(*pendingName) + "'", LogLevel::Warning);
+            pendingName = line;
+            continue;
+        }
+
+        insertSorted({ std::string(pendingName->substr(0, MAX_NAME_LENGTH)), score });
+        pendingName.reset();
+    }
+
+    return true;
+}
+
+bool HighScoreTable::save() const {
+    return AtomicFile::write(m_path, serialize());
+}
+
+void HighScoreTable::assign(const std::vector<Entry>& entries) {
+    m_entries.clear();
+    m_lastRank.reset();
+    for (const auto& entry : entries) {
+        insertSorted(entry);
+    }
+    save();
+}
+
+std::size_t HighScoreTable::rankFor(int score) const {
+    return insertionIndex(score) + 1;
+}
+
+std::optional<std::size_t> HighScoreTable::submit(const std::string& name, int score) {
+    std::size_t index = insertionIndex(score);
+    if (index >= m_capacity) {
+        return std::nullopt;
+    }
+
+    insertSorted({ name.substr(0, MAX_NAME_LENGTH), score });
+    m_lastRank = index + 1;
+
+    save();
+    ProfileStore::instance().data().highScores = m_entries;
+    return m_lastRank;
+}
+
+std::size_t HighScoreTable::insertionIndex(int score) const {
+    // After all equal scores - the earlier achiever keeps the higher rank
+    auto it = std::upper_bound(m_entries.begin(), m_entries.end(), score,
+        [](int value, const Entry& entry) { return value > entry.score; });
+    return static_cast<std::size_t>(it - m_entries.begin());
+}
+
+void HighScoreTable::insertSorted(Entry entry) {
+    std::size_t index = insertionIndex(entry.score);
+    if (index >= m_capacity) {
+        return;
+    }
+
+    m_entries.insert(m_entries.begin() + static_cast<std::ptrdiff_t>(index), std::move(entry));
+    if (m_entries.size() > m_capacity) {
+        m_entries.pop_back();
+    }
+}
+
+std::string HighScoreTable::serialize() const {
+    std::string text;
+    for (const auto& entry : m_entries) {
+        text += entry.name;
+        text += '\n';
+        text += std::to_string(entry.score);
+        text += '\n';
+    }
+    return text;
+}
@@ -0,0 +1,36 @@
+#include "InputEventBus.h"
+
+void InputEventBus::subscribe(sf::Event::EventType type, Handler handler) {
+    if (handler) {
+        m_handlers[type].push_back(std::move(handler));
+    }
+}
+
+void InputEventBus::subscribeKey(sf::Keyboard::Key key, std::function<void()> action) {
+    subscribe(sf::Event::KeyPressed, [key, action = std::move(action)](const InputEvent& input) {
+        if (input.event.key.code != key) {
+            return false;
+        }
+        action();
+        return true;
+    });
+}
+
+bool InputEventBus::dispatch(const InputEvent& input) const {
+    for (const auto& handler : m_handlers[input.event.type]) {
+        if (handler(input)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void InputEventBus::clear() {
+    for (auto& handlers : m_handlers) {
+        handlers.clear();
+    }
+}
+
+bool InputEventBus::hasSubscribers(sf::Event::EventType type) const {
+    return !m_handlers[type].empty();
+}
@@ -0,0 +1,101 @@
+#include "InputQueue.h"
+#include "LayoutManager.h"
+#include <chrono>
+
+void InputQueue::poll(sf::RenderWindow& window) {
+    m_systemEvents.clear();
+    m_events.clear();
+    m_polledCount = 0;
+
+    sf::Event event;
+    while (window.pollEvent(event)) {
+        ++m_polledCount;
+
+        auto& queue = isSystemEvent(event.type) ? m_systemEvents : m_events;
+        if (!queue.empty() && tryCoalesce(queue.back(), event)) {
+            continue;
+        }
+
+        InputEvent input;
+        input.event = event;
+        input.timestampUs = now();
+        input.sequence = m_nextSequence++;
+        queue.push_back(input);
+    }
+}
+
+void InputQueue::mapToVirtual(const sf::RenderWindow& window, const LayoutManager& layout) {
+    for (auto& input : m_events) {
+        input.event = layout.toVirtual(window, input.event);
+
+        switch (input.event.type) {
+        case sf::Event::MouseMoved:
+            input.position = sf::Vector2f(static_cast<float>(input.event.mouseMove.x),
+                static_cast<float>(input.event.mouseMove.y));
+            break;
+        case sf::Event::MouseButtonPressed:
+        case sf::Event::MouseButtonReleased:
+            input.position = sf::Vector2f(static_cast<float>(input.event.mouseButton.x),
+                static_cast<float>(input.event.mouseButton.y));
+            break;
+        case sf::Event::MouseWheelScrolled:
+            input.position = sf::Vector2f(static_cast<float>(input.event.mouseWheelScroll.x),
+                static_cast<float>(input.event.mouseWheelScroll.y));
+            break;
+        case sf::Event::TouchBegan:
+        case sf::Event::TouchMoved:
+        case sf::Event::TouchEnded:
+            input.position = sf::Vector2f(static_cast<float>(input.event.touch.x),
+                static_cast<float>(input.event.touch.y));
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+std::int64_t InputQueue::now() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool InputQueue::isSystemEvent(sf::Event::EventType type) {
+    switch (type) {
+    case sf::Event::Closed:
+    case sf::Event::Resized:
+    case sf::Event::LostFocus:
+    case sf::Event::GainedFocus:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool InputQueue::tryCoalesce(InputEvent& last, const sf::Event& event) {
+    if (last.event.type != event.type) {
+        return false;
+    }
+
+    // Keep the oldest timestamp so latency is measured from the first input of the run
+    switch (event.type) {
+    case sf::Event::MouseMoved:
+    case sf::Event::Resized:
+        last.event = event;
+        break;
+
+    case sf::Event::MouseWheelScrolled:
+        if (last.event.mouseWheelScroll.wheel != event.mouseWheelScroll.wheel) {
+            return false;
+        }
+        last.event.mouseWheelScroll.delta += event.mouseWheelScroll.delta;
+        last.event.mouseWheelScroll.x = event.mouseWheelScroll.x;
+        last.event.mouseWheelScroll.y = event.mouseWheelScroll.y;
+        break;
+
+    default:
+        return false;
+    }
+
+    ++last.coalescedCount;
+    return true;
+}
@@ -0,0 +1,167 @@
+#include "LatencyTracker.h"
+#include "InputQueue.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+void LatencyHistogram::record(std::int64_t latencyUs) {
+    latencyUs = std::max<std::int64_t>(latencyUs, 0);
+    float latencyMs = static_cast<float>(latencyUs) / 1000.0f;
+
+    auto edge = std::lower_bound(BUCKET_EDGES_MS.begin(), BUCKET_EDGES_MS.end(), latencyMs);
+    ++m_buckets[static_cast<std::size_t>(edge - BUCKET_EDGES_MS.begin())];
+
+    m_minUs = (m_count == 0) ? latencyUs : std::min(m_minUs, latencyUs);
+    m_maxUs = (m_count == 0) ? latencyUs : std::max(m_maxUs, latencyUs);
+    m_totalUs += latencyUs;
+    ++m_count;
+}
+
+void LatencyHistogram::reset() {
+    *this = LatencyHistogram();
+}
+
+float LatencyHistogram::getMinMs() const {
+    return static_cast<float>(m_minUs) / 1000.0f;
+}
+
+float LatencyHistogram::getMaxMs() const {
+    return static_cast<float>(m_maxUs) / 1000.0f;
+}
+
+float LatencyHistogram::getMeanMs() const {
+    return m_count ? static_cast<float>(m_totalUs) / static_cast<float>(m_count) / 1000.0f : 0.0f;
+}
+
+float LatencyHistogram::getPercentileMs(float percentile) const {
+    if (m_count == 0) {
+        return 0.0f;
+    }
+
+    auto target = static_cast<std::uint64_t>(std::ceil(static_cast<double>(m_count) * percentile / 100.0));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += m_buckets[i];
+        if (seen >= target) {
+            return (i < BUCKET_EDGES_MS.size()) ? BUCKET_EDGES_MS[i] : getMaxMs();
+        }
+    }
+    return getMaxMs();
+}
+
+LatencyTracker& LatencyTracker::instance() {
+    static LatencyTracker instance;
+    return instance;
+}
+
+LatencyTracker::LatencyTracker() {
+    m_pending.reserve(MAX_PENDING_TAGS);
+}
+
+void LatencyTracker::setEnabled(bool enabled) {
+    if (m_enabled == enabled) {
+        return;
+    }
+
+    m_enabled = enabled;
+    m_pending.clear();
+    Logger::log(std::string("Latency measurement ") + (enabled ? "enabled" : "disabled"));
+}
+
+void LatencyTracker::beginDispatch(const InputEvent& input) {
+    m_dispatching = true;
+    m_currentInputUs = input.timestampUs;
+}
+
+void LatencyTracker::endDispatch() {
+    m_dispatching = false;
+}
+
+void LatencyTracker::tagStateChange(const char* source) {
+    if (!m_enabled || !m_dispatching || m_pending.size() >= MAX_PENDING_TAGS) {
+        return;
+    }
+
+    m_pending.push_back({ source, m_currentInputUs });
+}
+
+void LatencyTracker::onFramePresented() {
+    if (m_pending.empty()) {
+        return;
+    }
+
+    std::int64_t presentedUs = InputQueue::now();
+    for (const auto& tag : m_pending) {
+        std::int64_t latencyUs = presentedUs - tag.inputTimestampUs;
+        histogramFor(tag.source).record(latencyUs);
+        m_overall.record(latencyUs);
+    }
+    m_pending.clear();
+}
+
+LatencyHistogram& LatencyTracker::histogramFor(const char* source) {
+    for (auto& stats : m_sources) {
+        if (stats.name == source) {
+            return stats.histogram;
+        }
+    }
+
+    m_sources.push_back({ source, LatencyHistogram() });
+    return m_sources.back().histogram;
+}
+
+std::string LatencyTracker::formatReport() const {
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(1);
+
+    auto writeHistogram = [&report](const std::string& name, const LatencyHistogram& histogram) {
+        report << name << ": n=" << histogram.getCount()
+            << " min=" << histogram.getMinMs() << "ms"
+            << " mean=" << histogram.getMeanMs() << "ms"
+            << " p50<=" << histogram.getPercentileMs(50.0f) << "ms"
+            << " p95<=" << histogram.getPercentileMs(95.0f) << "ms"
+            << " max=" << histogram.getMaxMs() << "ms\n";
+
+        const auto& buckets = histogram.getBuckets();
+        for (std::size_t i = 0; i < buckets.size(); ++i) {
+            if (buckets[i] == 0) continue;
+
+            if (i < LatencyHistogram::BUCKET_EDGES_MS.size()) {
+                report << "  <=" << std::setw(5) << LatencyHistogram::BUCKET_EDGES_MS[i] << "ms ";
+            }
+            else {
+                report << "  > " << std::setw(5) << LatencyHistogram::BUCKET_EDGES_MS.back() << "ms ";
+            }
+            report << std::setw(6) << buckets[i] << "\n";
+        }
+    };
+
+    report << "Input-to-display latency\n";
+    writeHistogram("all", m_overall);
+    for (const auto& stats : m_sources) {
+        writeHistogram(stats.name, stats.histogram);
+    }
+
+    return report.str();
+}
+
+bool LatencyTracker::writeReport(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        Logger::log("Could not write latency report to " + path, LogLevel::Warning);
+        return false;
+    }
+
+    file << formatReport();
+    Logger::log("Latency report written to " + path);
+    return true;
+}
+
+void LatencyTracker::reset() {
+    m_pending.clear();
+    m_sources.clear();
+    m_overall.reset();
+}
@@ -0,0 +1,116 @@
+#include "LayoutManager.h"
+#include <algorithm>
+#include <cmath>
+
+LayoutManager::LayoutManager()
+    : m_view(sf::FloatRect(0.0f, 0.0f, VIRTUAL_WIDTH, VIRTUAL_HEIGHT))
+    , m_windowSize(static_cast<unsigned int>(VIRTUAL_WIDTH), static_cast<unsigned int>(VIRTUAL_HEIGHT)) {
+}
+
+bool LayoutManager::updateForWindow(const sf::Vector2u& windowSize) {
+    if (windowSize == m_windowSize || windowSize.x == 0 || windowSize.y == 0) {
+        return false;
+    }
+
+    m_windowSize = windowSize;
+    recalculateView();
+    ++m_generation;
+    return true;
+}
+
+void LayoutManager::apply(sf::RenderTarget& target) const {
+    target.setView(m_view);
+}
+
+void LayoutManager::recalculateView() {
+    float windowWidth = static_cast<float>(m_windowSize.x);
+    float windowHeight = static_cast<float>(m_windowSize.y);
+
+    // Largest uniform scale that fits the design canvas inside the window
+    m_scale = std::min(windowWidth / VIRTUAL_WIDTH, windowHeight / VIRTUAL_HEIGHT);
+
+    // Snap the viewport to whole pixels so edges stay sharp
+    float viewportWidth = std::floor(VIRTUAL_WIDTH * m_scale);
+    float viewportHeight = std::floor(VIRTUAL_HEIGHT * m_scale);
+    float offsetX = std::floor((windowWidth - viewportWidth) * 0.5f);
+    float offsetY = std::floor((windowHeight - viewportHeight) * 0.5f);
+
+    m_view.reset(sf::FloatRect(0.0f, 0.0f, VIRTUAL_WIDTH, VIRTUAL_HEIGHT));
+    m_view.setViewport(sf::FloatRect(
+        offsetX / windowWidth,
+        offsetY / windowHeight,
+        viewportWidth / windowWidth,
+        viewportHeight / windowHeight));
+}
+
+sf::Vector2f LayoutManager::anchor(Anchor anchorPoint, const sf::Vector2f& offset, const sf::Vector2f& size) const {
+    float left = 0.0f;
+    float centerX = (VIRTUAL_WIDTH - size.x) * 0.5f;
+    float right = VIRTUAL_WIDTH - size.x;
+    float top = 0.0f;
+    float centerY = (VIRTUAL_HEIGHT - size.y) * 0.5f;
+    float bottom = VIRTUAL_HEIGHT - size.y;
+
+    sf::Vector2f position;
+    switch (anchorPoint) {
+    case Anchor::TopLeft:     position = sf::Vector2f(left, top); break;
+    case Anchor::Top:         position = sf::Vector2f(centerX, top); break;
+    case Anchor::TopRight:    position = sf::Vector2f(right, top); break;
+    case Anchor::Left:        position = sf::Vector2f(left, centerY); break;
+    case Anchor::Center:      position = sf::Vector2f(centerX, centerY); break;
+    case Anchor::Right:       position = sf::Vector2f(right, centerY); break;
+    case Anchor::BottomLeft:  position = sf::Vector2f(left, bottom); break;
+    case Anchor::Bottom:      position = sf::Vector2f(centerX, bottom); break;
+    case Anchor::BottomRight: position = sf::Vector2f(right, bottom); break;
+    }
+
+    return position + offset;
+}
+
+sf::FloatRect LayoutManager::anchoredRect(Anchor anchorPoint, const sf::Vector2f& offset, const sf::Vector2f& size) const {
+    return sf::FloatRect(anchor(anchorPoint, offset, size), size);
+}
+
+sf::Vector2f LayoutManager::toVirtual(const sf::RenderWindow& window, int x, int y) const {
+    return window.mapPixelToCoords(sf::Vector2i(x, y), m_view);
+}
+
+sf::Event LayoutManager::toVirtual(const sf::RenderWindow& window, const sf::Event& event) const {
+    sf::Event mapped = event;
+
+    if (event.type == sf::Event::MouseMoved) {
+        sf::Vector2f pos = toVirtual(window, event.mouseMove.x, event.mouseMove.y);
+        mapped.mouseMove.x = static_cast<int>(std::lround(pos.x));
+        mapped.mouseMove.y = static_cast<int>(std::lround(pos.y));
+    }
+    else if (event.type == sf::Event::MouseButtonPressed || event.type == sf::Event::MouseButtonReleased) {
+        sf::Vector2f pos = toVirtual(window, event.mouseButton.x, event.mouseButton.y);
+        mapped.mouseButton.x = static_cast<int>(std::lround(pos.x));
+        mapped.mouseButton.y = static_cast<int>(std::lround(pos.y));
+    }
+    else if (event.type == sf::Event::MouseWheelScrolled) {
+        sf::Vector2f pos = toVirtual(window, event.mouseWheelScroll.x, event.mouseWheelScroll.y);
+        mapped.mouseWheelScroll.x = static_cast<int>(std::lround(pos.x));
+        mapped.mouseWheelScroll.y = static_cast<int>(std::lround(pos.y));
+    }
+    else if (event.type == sf::Event::TouchBegan || event.type == sf::Event::TouchMoved || event.type == sf::Event::TouchEnded) {
+        sf::Vector2f pos = toVirtual(window, event.touch.x, event.touch.y);
+        mapped.touch.x = static_cast<int>(std::lround(pos.x));
+        mapped.touch.y = static_cast<int>(std::lround(pos.y));
+    }
+
+    return mapped;
+}
+
+void LayoutManager::fitToCanvas(sf::Sprite& sprite) const {
+    const sf::Texture* texture = sprite.getTexture();
+    if (!texture) {
+        return;
+    }
+
+    sf::Vector2u textureSize = texture->getSize();
+    if (textureSize.x > 0 && textureSize.y > 0) {
+        sprite.setScale(VIRTUAL_WIDTH / static_cast<float>(textureSize.x),
+            VIRTUAL_HEIGHT / static_cast<float>(textureSize.y));
+    }
+}
@@ -0,0 +1,103 @@
+#include "MappedFile.h"
+#include <fstream>
+#include <iterator>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping) {
+            void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (view) {
+                m_file = file;
+                m_mapping = mapping;
+                m_data = static_cast<const std::uint8_t*>(view);
+                m_size = static_cast<std::size_t>(fileSize.QuadPart);
+                return true;
+            }
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+#else
+    int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return false;
+    }
+
+    struct stat info {};
+    if (fstat(descriptor, &info) == 0 && info.st_size > 0) {
+        void* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+        ::close(descriptor); // The mapping keeps the file referenced
+        if (view != MAP_FAILED) {
+            m_mapped = true;
+            m_data = static_cast<const std::uint8_t*>(view);
+            m_size = static_cast<std::size_t>(info.st_size);
+            return true;
+        }
+    }
+    else {
+        ::close(descriptor);
+    }
+#endif
+
+    // Mapping failed (or empty file) - fall back to a plain read
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open()) {
+        return false;
+    }
+
+    m_fallback.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    if (m_fallback.empty()) {
+        return false;
+    }
+
+    m_data = m_fallback.data();
+    m_size = m_fallback.size();
+    return true;
+}
+
+void MappedFile::close() {
+#ifdef _WIN32
+    if (m_mapping) {
+        UnmapViewOfFile(m_data);
+        CloseHandle(static_cast<HANDLE>(m_mapping));
+        CloseHandle(static_cast<HANDLE>(m_file));
+        m_mapping = nullptr;
+        m_file = nullptr;
+    }
+#else
+    if (m_mapped) {
+        munmap(const_cast<std::uint8_t*>(m_data), m_size);
+        m_mapped = false;
+    }
+#endif
+
+    m_fallback.clear();
+    m_data = nullptr;
+    m_size = 0;
+}
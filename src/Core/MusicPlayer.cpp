@@ -0,0 +1,219 @@
+#include "MusicPlayer.h"
+#include "Logger.h"
+#include <algorithm>
+
+bool MusicPlayer::load(const std::string& name, const std::string& filePath) {
+    auto music = std::make_unique<sf::Music>();
+    if (!music->openFromFile(filePath)) {
+        Logger::log("Failed to open music: " + filePath, LogLevel::Warning);
+        return false;
+    }
+
+    return adopt(name, std::move(music));
+}
+
+bool MusicPlayer::adopt(const std::string& name, std::unique_ptr<sf::Music> music) {
+    if (!music) {
+        return false;
+    }
+
+    // Never replace a track while a deck is streaming it
+    if (m_current.name == name || m_outgoing.name == name) {
+        Logger::log("Music '" + name + "' is playing - reload skipped", LogLevel::Warning);
+        return true;
+    }
+
+    m_tracks[name] = std::move(music);
+    return true;
+}
+
+bool MusicPlayer::hasTrack(const std::string& name) const {
+    return m_tracks.find(name) != m_tracks.end();
+}
+
+void MusicPlayer::play(const std::string& name, bool loop, float fadeSeconds) {
+    m_playlist.clear();
+
+    if (name == m_current.name && m_current.music) {
+        m_current.music->setLoop(loop);
+        return;
+    }
+
+    startTrack(name, loop, fadeSeconds);
+}
+
+void MusicPlayer::playPlaylist(const std::vector<std::string>& tracks, bool repeat, float fadeSeconds) {
+    std::vector<std::string> playable;
+    for (const auto& track : tracks) {
+        if (hasTrack(track)) {
+            playable.push_back(track);
+        }
+    }
+
+    if (playable.empty()) {
+        return;
+    }
+
+    if (playable.size() == 1) {
+        play(playable.front(), repeat, fadeSeconds);
+        return;
+    }
+
+    // Already running this playlist - keep going instead of restarting it
+    if (playable == m_playlist) {
+        return;
+    }
+
+    m_playlist = std::move(playable);
+    m_repeatPlaylist = repeat;
+    m_crossfade = fadeSeconds;
+
+    // Continue from the current track if it is part of the new list
+    auto it = std::find(m_playlist.begin(), m_playlist.end(), m_current.name);
+    if (it != m_playlist.end() && m_current.music) {
+        m_playlistIndex = static_cast<std::size_t>(it - m_playlist.begin());
+        m_current.music->setLoop(false);
+        return;
+    }
+
+    m_playlistIndex = 0;
+    startTrack(m_playlist.front(), false, fadeSeconds);
+}
+
+void MusicPlayer::stop(float fadeSeconds) {
+    m_playlist.clear();
+    fadeOutCurrent(fadeSeconds);
+}
+
+void MusicPlayer::pause() {
+    m_paused = true;
+    if (m_current.music) m_current.music->pause();
+    if (m_outgoing.music) m_outgoing.music->pause();
+}
+
+void MusicPlayer::resume() {
+    m_paused = false;
+    if (m_current.music) m_current.music->play();
+    if (m_outgoing.music) m_outgoing.music->play();
+}
+
+void MusicPlayer::update(float deltaTime) {
+    if (m_paused) {
+        return;
+    }
+
+    if (m_outgoing.music && !advanceFade(m_outgoing, deltaTime)) {
+        m_outgoing.music->stop();
+        m_outgoing = Deck();
+    }
+
+    if (!m_current.music) {
+        return;
+    }
+
+    advanceFade(m_current, deltaTime);
+
+    if (m_playlist.empty()) {
+        return;
+    }
+
+    // Start the next track early so its fade-in overlaps the tail of this one
+    float remaining = m_current.music->getDuration().asSeconds() - m_current.music->getPlayingOffset().asSeconds();
+    if (m_current.music->getStatus() == sf::Music::Stopped || remaining <= m_crossfade) {
+        advancePlaylist();
+    }
+}
+
+void MusicPlayer::setVolume(float volume) {
+    m_volume = std::clamp(volume, 0.0f, 100.0f);
+    applyVolume(m_current);
+    applyVolume(m_outgoing);
+}
+
+void MusicPlayer::startTrack(const std::string& name, bool loop, float fadeSeconds) {
+    auto it = m_tracks.find(name);
+    if (it == m_tracks.end()) {
+        return;
+    }
+
+    // Requested the track that is fading out - bring it back from its current level
+    if (m_outgoing.name == name) {
+        std::swap(m_current, m_outgoing);
+        m_outgoing.fadeRate = -rateFor(fadeSeconds);
+        m_current.fadeRate = rateFor(fadeSeconds);
+        m_current.music->setLoop(loop);
+        return;
+    }
+
+    fadeOutCurrent(fadeSeconds);
+
+    m_current.music = it->second.get();
+    m_current.name = name;
+    m_current.gain = (fadeSeconds > 0.0f) ? 0.0f : 1.0f;
+    m_current.fadeRate = rateFor(fadeSeconds);
+
+    m_current.music->setLoop(loop);
+    m_current.music->setPlayingOffset(sf::Time::Zero);
+    applyVolume(m_current);
+    if (!m_paused) {
+        m_current.music->play();
+    }
+}
+
+void MusicPlayer::fadeOutCurrent(float fadeSeconds) {
+    if (!m_current.music) {
+        return;
+    }
+
+    // Only two decks - a track still fading out is cut when a third one starts
+    if (m_outgoing.music) {
+        m_outgoing.music->stop();
+    }
+
+    m_outgoing = m_current;
+    m_current = Deck();
+
+    if (fadeSeconds <= 0.0f) {
+        m_outgoing.music->stop();
+        m_outgoing = Deck();
+        return;
+    }
+
+    m_outgoing.fadeRate = -rateFor(fadeSeconds);
+}
+
+void MusicPlayer::advancePlaylist() {
+    std::size_t next = m_playlistIndex + 1;
+    if (next >= m_playlist.size()) {
+        if (!m_repeatPlaylist) {
+            stop(m_crossfade);
+            return;
+        }
+        next = 0;
+    }
+
+    m_playlistIndex = next;
+    startTrack(m_playlist[next], false, m_crossfade);
+}
+
+bool MusicPlayer::advanceFade(Deck& deck, float deltaTime) {
+    if (deck.fadeRate != 0.0f) {
+        deck.gain = std::clamp(deck.gain + deck.fadeRate * deltaTime, 0.0f, 1.0f);
+        if (deck.gain == 0.0f || deck.gain == 1.0f) {
+            deck.fadeRate = 0.0f;
+        }
+        applyVolume(deck);
+    }
+
+    return deck.gain > 0.0f;
+}
+
+void MusicPlayer::applyVolume(Deck& deck) {
+    if (deck.music) {
+        deck.music->setVolume(m_volume * deck.gain);
+    }
+}
+
+float MusicPlayer::rateFor(float fadeSeconds) {
+    return fadeSeconds > 0.0f ? 1.0f / fadeSeconds : 1.0f;
+}
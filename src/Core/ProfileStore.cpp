@@ -0,0 +1,365 @@
+#include "ProfileStore.h"
+#include "MappedFile.h"
+#include "Logger.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <filesystem>
+#include <fstream>
+
+namespace {
+    constexpr std::array<std::uint8_t, 4> MAGIC = { 'D', 'B', 'P', 'F' };
+    constexpr std::size_t HEADER_SIZE = 16;
+
+    constexpr std::uint32_t makeTag(char a, char b, char c, char d) {
+        return static_cast<std::uint32_t>(a) | (static_cast<std::uint32_t>(b) << 8)
+            | (static_cast<std::uint32_t>(c) << 16) | (static_cast<std::uint32_t>(d) << 24);
+    }
+
+    constexpr std::uint32_t TAG_SETTINGS = makeTag('S', 'E', 'T', 'T');
+    constexpr std::uint32_t TAG_SCORES = makeTag('S', 'C', 'O', 'R');
+    constexpr std::uint32_t TAG_UNLOCKS = makeTag('U', 'N', 'L', 'K');
+
+    constexpr std::array<std::uint32_t, 256> makeCrcTable() {
+        std::array<std::uint32_t, 256> table{};
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            std::uint32_t crc = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+            }
+            table[i] = crc;
+        }
+        return table;
+    }
+
+    constexpr auto CRC_TABLE = makeCrcTable();
+
+    std::uint32_t crc32(const std::uint8_t* bytes, std::size_t size) {
+        std::uint32_t crc = 0xFFFFFFFFu;
+        for (std::size_t i = 0; i < size; ++i) {
+            crc = CRC_TABLE[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+        }
+        return crc ^ 0xFFFFFFFFu;
+    }
+
+    class Writer {
+    public:
+        void u8(std::uint8_t value) { m_bytes.push_back(value); }
+        void u16(std::uint16_t value) { put(value, 2); }
+        void u32(std::uint32_t value) { put(value, 4); }
+
+        // Length-prefixed, at most 255 bytes
+        void text(std::string_view value) {
+            std::size_t length = std::min<std::size_t>(value.size(), 255);
+            u8(static_cast<std::uint8_t>(length));
+            m_bytes.insert(m_bytes.end(), value.begin(), value.begin() + length);
+        }
+
+        std::size_t position() const { return m_bytes.size(); }
+        void patchU32(std::size_t at, std::uint32_t value) {
+            for (std::size_t i = 0; i < 4; ++i) m_bytes[at + i] = static_cast<std::uint8_t>(value >> (8 * i));
+        }
+
+        std::vector<std::uint8_t>& bytes() { return m_bytes; }
+
+    private:
+        void put(std::uint32_t value, std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i) m_bytes.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+        }
+
+        std::vector<std::uint8_t> m_bytes;
+    };
+
+    // Bounds-checked reads - any overrun marks the reader as failed
+    class Reader {
+    public:
+        Reader(const std::uint8_t* bytes, std::size_t size) : m_bytes(bytes), m_size(size) {}
+
+        bool ok() const { return m_ok; }
+        bool atEnd() const { return m_position >= m_size; }
+
+        std::uint8_t u8() { return static_cast<std::uint8_t>(get(1)); }
+        std::uint16_t u16() { return static_cast<std::uint16_t>(get(2)); }
+        std::uint32_t u32() { return get(4); }
+
+        std::string text() {
+            std::size_t length = u8();
+            if (!require(length)) return {};
+            std::string value(reinterpret_cast<const char*>(m_bytes + m_position), length);
+            m_position += length;
+            return value;
+        }
+
+        Reader sub(std::size_t length) {
+            if (!require(length)) return Reader(nullptr, 0);
+            Reader reader(m_bytes + m_position, length);
+            m_position += length;
+            return reader;
+        }
+
+    private:
+        bool require(std::size_t count) {
+            if (!m_ok || m_size - m_position < count) {
+                m_ok = false;
+            }
+            return m_ok;
+        }
+
+        std::uint32_t get(std::size_t count) {
+            if (!require(count)) return 0;
+            std::uint32_t value = 0;
+            for (std::size_t i = 0; i < count; ++i) value |= static_cast<std::uint32_t>(m_bytes[m_position + i]) << (8 * i);
+            m_position += count;
+            return value;
+        }
+
+        const std::uint8_t* m_bytes;
+        std::size_t m_size;
+        std::size_t m_position = 0;
+        bool m_ok = true;
+    };
+
+    void encodeSettings(Writer& out, const SettingsRegistry::Values& values) {
+        // By key, not index - the schema may gain or reorder settings between versions
+        out.u16(static_cast<std::uint16_t>(values.size()));
+        for (const auto& descriptor : SETTINGS_SCHEMA) {
+            const SettingValue& value = values[static_cast<std::size_t>(descriptor.id)];
+            out.text(descriptor.key);
+            out.u8(static_cast<std::uint8_t>(value.index()));
+            std::visit([&out](auto v) {
+                if constexpr (std::is_same_v<decltype(v), float>) out.u32(std::bit_cast<std::uint32_t>(v));
+                else out.u32(static_cast<std::uint32_t>(v));
+            }, value);
+        }
+    }
+
+    SettingsRegistry::Values decodeSettings(Reader& in) {
+        SettingsRegistry::Values values;
+        for (const auto& descriptor : SETTINGS_SCHEMA) {
+            values[static_cast<std::size_t>(descriptor.id)] = descriptor.defaultValue;
+        }
+
+        std::uint16_t count = in.u16();
+        for (std::uint16_t i = 0; i < count && in.ok(); ++i) {
+            std::string key = in.text();
+            std::uint8_t type = in.u8();
+            std::uint32_t raw = in.u32();
+
+            auto id = SettingsRegistry::instance().findKey(key);
+            if (!id) {
+                continue; // Setting removed since this snapshot was written
+            }
+
+            SettingValue value;
+            switch (type) {
+            case 0: value = raw != 0; break;
+            case 1: value = static_cast<int>(raw); break;
+            case 2: value = std::bit_cast<float>(raw); break;
+            default: continue;
+            }
+            values[static_cast<std::size_t>(*id)] = value;
+        }
+        return values;
+    }
+}
+
+ProfileStore& ProfileStore::instance() {
+    static ProfileStore instance;
+    return instance;
+}
+
+ProfileStore::LoadResult ProfileStore::load() {
+    namespace fs = std::filesystem;
+    const std::string backupPath = m_path + ".bak";
+
+    std::error_code error;
+    bool hasProfile = fs::exists(m_path, error);
+    bool hasBackup = fs::exists(backupPath, error);
+
+    if (!hasProfile && !hasBackup) {
+        return LoadResult::Missing;
+    }
+
+    if (hasProfile) {
+        if (auto data = readFile(m_path)) {
+            m_data = std::move(*data);
+            return LoadResult::Loaded;
+        }
+        Logger::log("Profile " + m_path + " is damaged - trying the backup", LogLevel::Warning);
+    }
+
+    // Interrupted save (between the renames) or a corrupt file - roll back to the last good snapshot
+    if (hasBackup) {
+        if (auto data = readFile(backupPath)) {
+            m_data = std::move(*data);
+            fs::copy_file(backupPath, m_path, fs::copy_options::overwrite_existing, error);
+            Logger::log("Profile restored from " + backupPath, LogLevel::Warning);
+            return LoadResult::RolledBack;
+        }
+    }
+
+    Logger::log("No usable profile snapshot - keeping defaults", LogLevel::Error);
+    return LoadResult::Corrupt;
+}
+
+bool ProfileStore::save() {
+    namespace fs = std::filesystem;
+    const std::string tempPath = m_path + ".tmp";
+    const std::string backupPath = m_path + ".bak";
+
+    std::vector<std::uint8_t> bytes = encode(m_data);
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open() || !file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+            Logger::log("Failed to write " + tempPath, LogLevel::Error);
+            return false;
+        }
+    }
+
+    // Keep the last good snapshot - only a valid profile.dat becomes the backup
+    std::error_code error;
+    if (fs::exists(m_path, error) && readFile(m_path)) {
+        fs::rename(m_path, backupPath, error);
+    }
+
+    fs::rename(tempPath, m_path, error);
+    if (error) {
+        Logger::log("Failed to replace " + m_path + ": " + error.message(), LogLevel::Error);
+        return false;
+    }
+    return true;
+}
+
+void ProfileStore::captureSettings() {
+    m_data.settings = SettingsRegistry::instance().values();
+}
+
+bool ProfileStore::restoreSettings() const {
+    if (!m_data.settings) {
+        return false;
+    }
+
+    auto& registry = SettingsRegistry::instance();
+    for (const auto& descriptor : SETTINGS_SCHEMA) {
+        registry.set(descriptor.id, (*m_data.settings)[static_cast<std::size_t>(descriptor.id)]);
+    }
+    return true;
+}
+
+bool ProfileStore::isUnlocked(std::string_view id) const {
+    return std::find(m_data.unlocks.begin(), m_data.unlocks.end(), id) != m_data.unlocks.end();
+}
+
+void ProfileStore::unlock(std::string_view id) {
+    if (!isUnlocked(id)) {
+        m_data.unlocks.emplace_back(id);
+    }
+}
+
+std::vector<std::uint8_t> ProfileStore::encode(const ProfileData& data) {
+    Writer out;
+    out.bytes().insert(out.bytes().end(), MAGIC.begin(), MAGIC.end());
+    out.u16(FORMAT_VERSION);
+    out.u16(0);   // Section count, patched below
+    out.u32(0);   // Payload size
+    out.u32(0);   // Checksum
+
+    std::uint16_t sections = 0;
+    auto section = [&](std::uint32_t tag, auto&& body) {
+        out.u32(tag);
+        std::size_t sizeAt = out.position();
+        out.u32(0);
+        body();
+        out.patchU32(sizeAt, static_cast<std::uint32_t>(out.position() - sizeAt - 4));
+        ++sections;
+    };
+
+    if (data.settings) {
+        section(TAG_SETTINGS, [&] { encodeSettings(out, *data.settings); });
+    }
+
+    section(TAG_SCORES, [&] {
+        out.u32(static_cast<std::uint32_t>(data.highScores.size()));
+        for (const auto& record : data.highScores) {
+            out.text(record.name);
+            out.u32(static_cast<std::uint32_t>(record.score));
+        }
+    });
+
+    section(TAG_UNLOCKS, [&] {
+        out.u32(static_cast<std::uint32_t>(data.unlocks.size()));
+        for (const auto& id : data.unlocks) {
+            out.text(id);
+        }
+    });
+
+    auto& bytes = out.bytes();
+    bytes[6] = static_cast<std::uint8_t>(sections);
+    bytes[7] = static_cast<std::uint8_t>(sections >> 8);
+    out.patchU32(8, static_cast<std::uint32_t>(bytes.size() - HEADER_SIZE));
+    out.patchU32(12, crc32(bytes.data() + HEADER_SIZE, bytes.size() - HEADER_SIZE));
+    return std::move(bytes);
+}
+
+std::optional<ProfileData> ProfileStore::decode(const std::uint8_t* bytes, std::size_t size) {
+    if (size < HEADER_SIZE || !std::equal(MAGIC.begin(), MAGIC.end(), bytes)) {
+        return std::nullopt;
+    }
+
+    Reader header(bytes + MAGIC.size(), HEADER_SIZE - MAGIC.size());
+    std::uint16_t version = header.u16();
+    std::uint16_t sectionCount = header.u16();
+    std::uint32_t payloadSize = header.u32();
+    std::uint32_t checksum = header.u32();
+
+    // Written by a newer build, truncated, or bit-rotted
+    if (version == 0 || version > FORMAT_VERSION || payloadSize != size - HEADER_SIZE
+        || crc32(bytes + HEADER_SIZE, payloadSize) != checksum) {
+        return std::nullopt;
+    }
+
+    ProfileData data;
+    Reader payload(bytes + HEADER_SIZE, payloadSize);
+    for (std::uint16_t i = 0; i < sectionCount && payload.ok(); ++i) {
+        std::uint32_t tag = payload.u32();
+        Reader body = payload.sub(payload.u32());
+
+        if (tag == TAG_SETTINGS) {
+            data.settings = decodeSettings(body);
+        }
+        else if (tag == TAG_SCORES) {
+            std::uint32_t count = body.u32();
+            for (std::uint32_t n = 0; n < count && body.ok(); ++n) {
+                HighScoreRecord record;
+                record.name = body.text();
+                record.score = static_cast<std::int32_t>(body.u32());
+                if (body.ok()) data.highScores.push_back(std::move(record));
+            }
+        }
+        else if (tag == TAG_UNLOCKS) {
+            std::uint32_t count = body.u32();
+            for (std::uint32_t n = 0; n < count && body.ok(); ++n) {
+                std::string id = body.text();
+                if (body.ok()) data.unlocks.push_back(std::move(id));
+            }
+        }
+        // Unknown tags are skipped
+
+        if (!body.ok()) {
+            return std::nullopt;
+        }
+    }
+
+    if (!payload.ok()) {
+        return std::nullopt;
+    }
+    return data;
+}
+
+std::optional<ProfileData> ProfileStore::readFile(const std::string& path) {
+    MappedFile file;
+    if (!file.open(path)) {
+        return std::nullopt;
+    }
+    return decode(file.data(), file.size());
+}
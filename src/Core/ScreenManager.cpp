@@ -5,15 +5,36 @@ void ScreenManager::registerScreen(ScreenType type, std::function<std::unique_pt
 }
 
 void ScreenManager::changeScreen(ScreenType type) {
-    auto it = m_creators.find(type);
-    if (it != m_creators.end()) {
-        m_currentScreen = it->second();
+    if (m_creators.find(type) != m_creators.end()) {
+        m_pendingScreen = type;
     }
 }
 
-void ScreenManager::handleEvents(sf::RenderWindow& window) {
+void ScreenManager::applyPendingScreenChange() {
+    if (!m_pendingScreen) {
+        return;
+    }
+
+    ScreenType type = *m_pendingScreen;
+    m_pendingScreen.reset();
+
+    // Old handlers capture the old screen - drop them before it is destroyed
+    m_inputBus.clear();
+    m_currentScreen = m_creators[type]();
+    m_currentType = type;
+
     if (m_currentScreen) {
-        m_currentScreen->handleEvents(window);
+        m_currentScreen->registerInputHandlers(m_inputBus);
+    }
+
+    if (m_onScreenChanged) {
+        m_onScreenChanged(type);
+    }
+}
+
+void ScreenManager::dispatchInput(const InputEvent& input) {
+    if (m_currentScreen) {
+        m_inputBus.dispatch(input);
     }
 }
 
@@ -27,4 +48,4 @@ void ScreenManager::render(sf::RenderWindow& window) {
     if (m_currentScreen) {
         m_currentScreen->render(window);
     }
-}
\ No newline at end of file
+}
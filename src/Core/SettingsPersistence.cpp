@@ -0,0 +1,129 @@
+#include "SettingsPersistence.h"
+#include "AtomicFile.h"
+#include "Logger.h"
+#include <algorithm>
+
+SettingsPersistence& SettingsPersistence::instance() {
+    static SettingsPersistence instance;
+    return instance;
+}
+
+SettingsPersistence::~SettingsPersistence() {
+    flush();
+    m_worker.request_stop();
+    m_changed.notify_all();
+}
+
+bool SettingsPersistence::load(AudioSettings& settings) {
+    auto& registry = SettingsRegistry::instance();
+    if (!registry.loadFromFile(m_filename)) {
+        return false;
+    }
+    settings = AudioSettingsManager::read(registry);
+
+    // An older format is rewritten on the next submit even if no value changed
+    if (registry.getLoadedVersion() == SETTINGS_VERSION) {
+        std::lock_guard lock(m_writeMutex);
+        m_persisted = registry.values();
+    }
+    return true;
+}
+
+void SettingsPersistence::submit(const AudioSettings& settings) {
+    AudioSettingsManager::write(settings);
+    submit();
+}
+
+void SettingsPersistence::submit() {
+    {
+        std::lock_guard lock(m_mutex);
+        m_pending = SettingsRegistry::instance().values();
+        m_deadline = std::chrono::steady_clock::now()
+            + std::chrono::duration_cast<std::chrono::steady_clock::duration>(m_delay);
+    }
+
+    if (!m_worker.joinable()) {
+        m_worker = std::jthread([this](std::stop_token stopToken) { workerLoop(stopToken); });
+    }
+
+    m_changed.notify_all();
+}
+
+void SettingsPersistence::flush() {
+    std::lock_guard writeLock(m_writeMutex);
+    std::optional<SettingsRegistry::Values> pending;
+    {
+        std::lock_guard lock(m_mutex);
+        pending.swap(m_pending);
+    }
+
+    if (pending) {
+        writeIfChanged(*pending);
+    }
+}
+
+void SettingsPersistence::setDebounceDelay(float seconds) {
+    std::lock_guard lock(m_mutex);
+    m_delay = std::chrono::duration<float>(std::max(0.0f, seconds));
+}
+
+float SettingsPersistence::getDebounceDelay() const {
+    std::lock_guard lock(m_mutex);
+    return m_delay.count();
+}
+
+bool SettingsPersistence::hasPendingWrite() const {
+    std::lock_guard lock(m_mutex);
+    return m_pending.has_value();
+}
+
+void SettingsPersistence::workerLoop(std::stop_token stopToken) {
+    while (true) {
+        std::unique_lock lock(m_mutex);
+        if (!m_changed.wait(lock, stopToken, [this] { return m_pending.has_value(); })) {
+            return; // Stop requested - the destructor flushes what is left
+        }
+
+        // Every submit pushes the deadline back - wait until changes settle
+        while (m_pending && std::chrono::steady_clock::now() < m_deadline) {
+            auto deadline = m_deadline;
+            m_changed.wait_until(lock, stopToken, deadline,
+                [this, deadline] { return !m_pending || m_deadline != deadline; });
+            if (stopToken.stop_requested()) {
+                return;
+            }
+        }
+
+        if (!m_pending) {
+            continue; // Flushed meanwhile
+        }
+
+        // Hold the write lock from taking the snapshot until it is on disk - otherwise a
+        // submit() + flush() in between would be overwritten with these older values
+        lock.unlock();
+        std::lock_guard writeLock(m_writeMutex);
+        lock.lock();
+        if (!m_pending) {
+            continue; // Flushed while we waited for the write lock
+        }
+
+        SettingsRegistry::Values values = *m_pending;
+        m_pending.reset();
+        lock.unlock();
+
+        writeIfChanged(values);
+    }
+}
+
+void SettingsPersistence::writeIfChanged(const SettingsRegistry::Values& values) {
+    if (m_persisted && *m_persisted == values) {
+        return;
+    }
+
+    if (AtomicFile::write(m_filename, SettingsRegistry::serialize(values))) {
+        m_persisted = values;
+    }
+    else {
+        Logger::log("Failed to write " + m_filename, LogLevel::Warning);
+    }
+}
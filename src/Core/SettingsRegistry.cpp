@@ -0,0 +1,266 @@
+#include "SettingsRegistry.h"
+#include "Logger.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <type_traits>
+
+namespace {
+    std::string_view trim(std::string_view text) {
+        const char* whitespace = " \t\r";
+        std::size_t first = text.find_first_not_of(whitespace);
+        if (first == std::string_view::npos) {
+            return {};
+        }
+        std::size_t last = text.find_last_not_of(whitespace);
+        return text.substr(first, last - first + 1);
+    }
+
+    template <typename T>
+    std::optional<T> parseNumber(std::string_view text) {
+        T value{};
+        auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (error != std::errc() || end != text.data() + text.size()) {
+            return std::nullopt;
+        }
+        return value;
+    }
+}
+
+SettingsRegistry& SettingsRegistry::instance() {
+    static SettingsRegistry instance;
+    return instance;
+}
+
+SettingsRegistry::SettingsRegistry() {
+    for (const auto& descriptor : SETTINGS_SCHEMA) {
+        m_values[index(descriptor.id)] = descriptor.defaultValue;
+    }
+    buildKeyTable();
+}
+
+bool SettingsRegistry::set(SettingId id, SettingValue value) {
+    SettingValue normalized = normalize(describe(id), value);
+    if (m_values[index(id)] == normalized) {
+        return false;
+    }
+
+    m_values[index(id)] = normalized;
+    notify(id);
+    return true;
+}
+
+void SettingsRegistry::resetToDefaults() {
+    for (const auto& descriptor : SETTINGS_SCHEMA) {
+        set(descriptor.id, descriptor.defaultValue);
+    }
+}
+
+SettingsRegistry::ListenerId SettingsRegistry::subscribe(SettingId id, Listener listener) {
+    ListenerId listenerId = m_nextListenerId++;
+    m_listeners.push_back({ listenerId, id, std::move(listener) });
+    return listenerId;
+}
+
+void SettingsRegistry::unsubscribe(ListenerId listenerId) {
+    std::erase_if(m_listeners, [listenerId](const Subscription& s) { return s.id == listenerId; });
+}
+
+void SettingsRegistry::notify(SettingId id) {
+    // By index - a listener may subscribe others while we iterate
+    for (std::size_t i = 0; i < m_listeners.size(); ++i) {
+        if (m_listeners[i].setting == id) {
+            Listener callback = m_listeners[i].callback;
+            callback(id);
+        }
+    }
+}
+
+bool SettingsRegistry::loadFromFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    parse(text);
+
+    if (m_loadedVersion < SETTINGS_VERSION) {
+        Logger::log("Settings migrated from version " + std::to_string(m_loadedVersion)
+            + " to " + std::to_string(SETTINGS_VERSION));
+    }
+    return true;
+}
+
+std::size_t SettingsRegistry::parse(std::string_view text) {
+    // No version line = a file from before the registry
+    int fileVersion = 0;
+    std::size_t applied = 0;
+
+    std::size_t position = 0;
+    while (position < text.size()) {
+        std::size_t end = text.find('\n', position);
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+
+        std::string_view line = trim(text.substr(position, end - position));
+        position = end + 1;
+
+        if (line.empty() || line.front() == '#') {
+            continue;
+        }
+
+        std::size_t separator = line.find('=');
+        if (separator == std::string_view::npos) {
+            continue;
+        }
+
+        std::string_view key = trim(line.substr(0, separator));
+        std::string_view valueText = trim(line.substr(separator + 1));
+
+        if (key == "version") {
+            fileVersion = parseNumber<int>(valueText).value_or(0);
+            continue;
+        }
+
+        std::optional<SettingId> id = findKey(key);
+        if (!id && fileVersion < SETTINGS_VERSION) {
+            id = findLegacyKey(key, fileVersion);
+        }
+        if (!id) {
+            Logger::log("Unknown setting ignored: " + std::string(key), LogLevel::Warning);
+            continue;
+        }
+
+        std::optional<SettingValue> value = parseValue(describe(*id).type, valueText);
+        if (!value) {
+            Logger::log("Invalid value for " + std::string(key) + ": " + std::string(valueText), LogLevel::Warning);
+            continue;
+        }
+
+        set(*id, *value);
+        ++applied;
+    }
+
+    m_loadedVersion = fileVersion;
+    return applied;
+}
+
+std::string SettingsRegistry::serialize(const Values& values) {
+    std::ostringstream text;
+    text << "version=" << SETTINGS_VERSION << "\n";
+
+    for (const auto& descriptor : SETTINGS_SCHEMA) {
+        text << descriptor.key << "=";
+        std::visit([&text](auto value) {
+            if constexpr (std::is_same_v<decltype(value), bool>) {
+                text << (value ? "true" : "false");
+            }
+            else {
+                text << value;
+            }
+        }, values[index(descriptor.id)]);
+        text << "\n";
+    }
+
+    return text.str();
+}
+
+std::optional<SettingId> SettingsRegistry::findKey(std::string_view key) const {
+    std::size_t slot = m_keySlots[hashKey(key, m_hashSeed) & m_slotMask];
+    if (slot == SETTING_COUNT || SETTINGS_SCHEMA[slot].key != key) {
+        return std::nullopt;
+    }
+    return SETTINGS_SCHEMA[slot].id;
+}
+
+std::optional<SettingId> SettingsRegistry::findLegacyKey(std::string_view key, int fileVersion) const {
+    for (const auto& rename : SETTING_RENAMES) {
+        if (fileVersion < rename.beforeVersion && rename.oldKey == key) {
+            return rename.id;
+        }
+    }
+    return std::nullopt;
+}
+
+void SettingsRegistry::buildKeyTable() {
+    // Twice as many slots as keys, then search a seed without collisions (a few tries for a small schema)
+    std::size_t slotCount = 1;
+    while (slotCount < SETTING_COUNT * 2) {
+        slotCount <<= 1;
+    }
+
+    for (std::uint32_t seed = 1;; ++seed) {
+        if (seed % 1000 == 0) {
+            slotCount <<= 1; // Unlucky - give the keys more room
+        }
+
+        m_keySlots.assign(slotCount, SETTING_COUNT);
+        m_slotMask = static_cast<std::uint32_t>(slotCount - 1);
+
+        bool collided = false;
+        for (const auto& descriptor : SETTINGS_SCHEMA) {
+            std::size_t& slot = m_keySlots[hashKey(descriptor.key, seed) & m_slotMask];
+            if (slot != SETTING_COUNT) {
+                collided = true;
+                break;
+            }
+            slot = index(descriptor.id);
+        }
+
+        if (!collided) {
+            m_hashSeed = seed;
+            return;
+        }
+    }
+}
+
+std::uint32_t SettingsRegistry::hashKey(std::string_view key, std::uint32_t seed) {
+    // FNV-1a with the seed mixed into the offset basis
+    std::uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (char c : key) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619u;
+    }
+    return hash ^ (hash >> 15);
+}
+
+SettingValue SettingsRegistry::normalize(const SettingDescriptor& descriptor, SettingValue value) {
+    float number = std::visit([](auto v) { return static_cast<float>(v); }, value);
+
+    switch (descriptor.type) {
+    case SettingType::Bool:
+        return number != 0.0f;
+
+    case SettingType::Int:
+        return static_cast<int>(std::lround(std::clamp(number, descriptor.minValue, descriptor.maxValue)));
+
+    case SettingType::Float:
+        return std::clamp(number, descriptor.minValue, descriptor.maxValue);
+    }
+
+    return descriptor.defaultValue;
+}
+
+std::optional<SettingValue> SettingsRegistry::parseValue(SettingType type, std::string_view text) {
+    switch (type) {
+    case SettingType::Bool:
+        if (text == "1" || text == "true") return SettingValue(true);
+        if (text == "0" || text == "false") return SettingValue(false);
+        return std::nullopt;
+
+    case SettingType::Int:
+        if (auto value = parseNumber<int>(text)) return SettingValue(*value);
+        return std::nullopt;
+
+    case SettingType::Float:
+        if (auto value = parseNumber<float>(text)) return SettingValue(*value);
+        return std::nullopt;
+    }
+
+    return std::nullopt;
+}
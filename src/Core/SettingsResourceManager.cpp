@@ -57,6 +57,7 @@ bool SettingsResourceManager::loadBackgroundTexture() {
     try {
         bool loaded = m_backgroundTexture.loadFromFile(BACKGROUND_PATH);
         if (loaded) {
+            m_backgroundTexture.setSmooth(true);
             m_backgroundSprite.setTexture(m_backgroundTexture);
             std::cout << "Successfully loaded background texture: " << BACKGROUND_PATH << std::endl;
         }
@@ -0,0 +1,45 @@
+#include "BallController.h"
+#include "Components.h"
+#include "GiftSystem.h"
+#include <algorithm>
+#include <cmath>
+
+void BallController::update(World& world, Entity ball, const BallInput& input, float deltaTime) {
+    Velocity* velocity = world.tryGet<Velocity>(ball);
+    Ball* state = world.tryGet<Ball>(ball);
+    if (!velocity || !state) {
+        return;
+    }
+
+    sf::Vector2f& v = velocity->value;
+
+    float moveAxis = input.moveAxis;
+    float speedScale = 1.0f;
+    float headwind = 0.0f;
+    if (const Modifiers* modifiers = world.tryGet<Modifiers>(ball)) {
+        if (modifiers->stacksOf(ModifierType::ReverseMovement) % 2 == 1) {
+            moveAxis = -moveAxis;   // Two reverse gifts cancel out
+        }
+        speedScale = GiftSystem::speedScale(*modifiers);
+        headwind = GiftSystem::headwindAcceleration(*modifiers);
+    }
+    float maxSpeed = MAX_SPEED * speedScale;
+
+    if (moveAxis != 0.0f) {
+        v.x += moveAxis * ACCELERATION * speedScale * deltaTime;
+    }
+    else {
+        // Roll to a stop without overshooting through zero
+        float slowdown = std::min(std::abs(v.x), FRICTION * deltaTime);
+        v.x -= std::copysign(slowdown, v.x);
+    }
+    v.x -= headwind * deltaTime;
+    v.x = std::clamp(v.x, -maxSpeed, maxSpeed);
+
+    if (input.jumpRequested && state->grounded) {
+        v.y = -JUMP_SPEED;
+        state->grounded = false;
+    }
+
+    v.y = std::min(v.y + GRAVITY * deltaTime, MAX_FALL_SPEED);
+}
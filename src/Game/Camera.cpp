@@ -0,0 +1,85 @@
+#include "Camera.h"
+#include "Components.h"
+#include <algorithm>
+#include <cmath>
+
+void Camera::setViewSize(sf::Vector2f size) {
+    m_size = size;
+    m_view.setSize(size);
+    applyView();
+}
+
+void Camera::setBounds(const sf::FloatRect& bounds) {
+    m_bounds = bounds;
+    m_hasBounds = true;
+    applyView();
+}
+
+void Camera::snapTo(sf::Vector2f target) {
+    m_focus = target;
+    m_lookAhead = 0.0f;
+    m_center = clampToBounds(target);
+    applyView();
+}
+
+void Camera::follow(sf::Vector2f target, sf::Vector2f velocity, float deltaTime) {
+    // Drag the focus only by as much as the target left the dead zone
+    sf::Vector2f halfZone(DEAD_ZONE_WIDTH / 2.0f, DEAD_ZONE_HEIGHT / 2.0f);
+    m_focus.x = std::clamp(m_focus.x, target.x - halfZone.x, target.x + halfZone.x);
+    m_focus.y = std::clamp(m_focus.y, target.y - halfZone.y, target.y + halfZone.y);
+
+    // Frame-rate independent easing: the same fraction of the gap closes per second at any dt
+    float desiredLookAhead = LOOK_AHEAD * std::clamp(velocity.x / LOOK_AHEAD_SPEED, -1.0f, 1.0f);
+    m_lookAhead += (desiredLookAhead - m_lookAhead) * (1.0f - std::exp(-LOOK_AHEAD_RATE * deltaTime));
+
+    sf::Vector2f goal = clampToBounds(m_focus + sf::Vector2f(m_lookAhead, 0.0f));
+    m_center += (goal - m_center) * (1.0f - std::exp(-FOLLOW_RATE * deltaTime));
+    applyView();
+}
+
+sf::FloatRect Camera::getVisibleArea() const {
+    return sf::FloatRect(m_center - m_size / 2.0f, m_size);
+}
+
+void Camera::collectVisible(World& world, const SpatialHash& index, std::vector<Entity>& results) const {
+    sf::FloatRect area = getVisibleArea();
+    area.left -= CULL_MARGIN;
+    area.top -= CULL_MARGIN;
+    area.width += CULL_MARGIN * 2.0f;
+    area.height += CULL_MARGIN * 2.0f;
+
+    index.query(area, results);
+
+    // Balls are not in the index (PhysicsSystem sweeps them itself)
+    auto& positions = world.pool<Position>();
+    auto& circles = world.pool<CircleCollider>();
+    auto owners = circles.entities();
+    auto values = circles.components();
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const Position* position = positions.tryGet(owners[i].index);
+        float radius = values[i].radius;
+        if (position && area.intersects(sf::FloatRect(position->value.x - radius, position->value.y - radius, radius * 2.0f, radius * 2.0f))) {
+            results.push_back(owners[i]);
+        }
+    }
+}
+
+sf::Vector2f Camera::clampToBounds(sf::Vector2f center) const {
+    if (!m_hasBounds) {
+        return center;
+    }
+
+    auto clampAxis = [](float value, float start, float length, float viewLength) {
+        if (length <= viewLength) {
+            return start + length / 2.0f;
+        }
+        return std::clamp(value, start + viewLength / 2.0f, start + length - viewLength / 2.0f);
+    };
+
+    return sf::Vector2f(clampAxis(center.x, m_bounds.left, m_bounds.width, m_size.x),
+        clampAxis(center.y, m_bounds.top, m_bounds.height, m_size.y));
+}
+
+void Camera::applyView() {
+    m_view.setCenter(m_center);
+}
@@ -0,0 +1,133 @@
+#include "Collision.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    constexpr float EPSILON = 1e-6f;
+
+    float dot(sf::Vector2f a, sf::Vector2f b) {
+        return a.x * b.x + a.y * b.y;
+    }
+
+    sf::Vector2f closestPoint(sf::Vector2f point, const sf::FloatRect& box) {
+        return sf::Vector2f(
+            std::clamp(point.x, box.left, box.left + box.width),
+            std::clamp(point.y, box.top, box.top + box.height));
+    }
+
+    // Entry time of a ray into a circle, if it enters within [0, 1]
+    std::optional<float> rayCircle(sf::Vector2f start, sf::Vector2f delta, sf::Vector2f center, float radius) {
+        sf::Vector2f offset = start - center;
+        float a = dot(delta, delta);
+        float b = dot(offset, delta);
+        float c = dot(offset, offset) - radius * radius;
+        float discriminant = b * b - a * c;
+        if (a < EPSILON || discriminant < 0.0f) {
+            return std::nullopt;
+        }
+
+        float t = (-b - std::sqrt(discriminant)) / a;
+        if (t < 0.0f || t > 1.0f) {
+            return std::nullopt;
+        }
+        return t;
+    }
+}
+
+std::optional<SweepHit> Collision::sweepCircle(sf::Vector2f start, sf::Vector2f delta, float radius, const sf::FloatRect& box) {
+    float minX = box.left - radius;
+    float maxX = box.left + box.width + radius;
+    float minY = box.top - radius;
+    float maxY = box.top + box.height + radius;
+
+    // Slab test against the box grown by the radius
+    float enter = -std::numeric_limits<float>::infinity();
+    float exit = std::numeric_limits<float>::infinity();
+    sf::Vector2f normal;
+
+    auto slab = [&](float origin, float direction, float low, float high, sf::Vector2f axis) {
+        if (std::abs(direction) < EPSILON) {
+            return origin >= low && origin <= high;
+        }
+
+        float t1 = (low - origin) / direction;
+        float t2 = (high - origin) / direction;
+        sf::Vector2f faceNormal = -axis;
+        if (t1 > t2) {
+            std::swap(t1, t2);
+            faceNormal = axis;
+        }
+        if (t1 > enter) {
+            enter = t1;
+            normal = faceNormal;
+        }
+        exit = std::min(exit, t2);
+        return true;
+    };
+
+    if (!slab(start.x, delta.x, minX, maxX, sf::Vector2f(1.0f, 0.0f)) ||
+        !slab(start.y, delta.y, minY, maxY, sf::Vector2f(0.0f, 1.0f)) ||
+        enter > exit || enter < 0.0f || enter > 1.0f) {
+        return std::nullopt;
+    }
+
+    // Entry point beyond the box on both axes - that corner is rounded, test the corner circle
+    sf::Vector2f point = start + delta * enter;
+    bool outsideX = point.x < box.left || point.x > box.left + box.width;
+    bool outsideY = point.y < box.top || point.y > box.top + box.height;
+    if (outsideX && outsideY) {
+        sf::Vector2f corner(
+            point.x < box.left ? box.left : box.left + box.width,
+            point.y < box.top ? box.top : box.top + box.height);
+
+        auto t = rayCircle(start, delta, corner, radius);
+        if (!t) {
+            return std::nullopt;
+        }
+        sf::Vector2f contact = start + delta * *t - corner;
+        return SweepHit{ *t, contact / radius };
+    }
+
+    return SweepHit{ enter, normal };
+}
+
+std::optional<sf::Vector2f> Collision::penetration(sf::Vector2f center, float radius, const sf::FloatRect& box) {
+    sf::Vector2f closest = closestPoint(center, box);
+    sf::Vector2f offset = center - closest;
+    float distanceSquared = dot(offset, offset);
+
+    if (distanceSquared > EPSILON) {
+        if (distanceSquared >= radius * radius) {
+            return std::nullopt;
+        }
+        float distance = std::sqrt(distanceSquared);
+        return offset * ((radius - distance) / distance);
+    }
+
+    // Centre inside the box - leave through the nearest face
+    float left = center.x - box.left;
+    float right = box.left + box.width - center.x;
+    float top = center.y - box.top;
+    float bottom = box.top + box.height - center.y;
+    float nearest = std::min({ left, right, top, bottom });
+
+    if (nearest == top)   return sf::Vector2f(0.0f, -(top + radius));
+    if (nearest == bottom) return sf::Vector2f(0.0f, bottom + radius);
+    if (nearest == left)  return sf::Vector2f(-(left + radius), 0.0f);
+    return sf::Vector2f(right + radius, 0.0f);
+}
+
+bool Collision::overlaps(sf::Vector2f center, float radius, const sf::FloatRect& box) {
+    sf::Vector2f offset = center - closestPoint(center, box);
+    return dot(offset, offset) <= radius * radius;
+}
+
+sf::FloatRect Collision::sweptBounds(sf::Vector2f start, sf::Vector2f delta, float radius) {
+    sf::Vector2f end = start + delta;
+    float left = std::min(start.x, end.x) - radius;
+    float top = std::min(start.y, end.y) - radius;
+    return sf::FloatRect(left, top,
+        std::abs(delta.x) + radius * 2.0f,
+        std::abs(delta.y) + radius * 2.0f);
+}
@@ -0,0 +1,101 @@
+#include "EffectSystem.h"
+#include "SpriteRenderSystem.h"
+#include <algorithm>
+
+namespace {
+    struct EffectPreset {
+        sf::Vector2f velocity;   // px/s
+        float lifetime;          // seconds
+        float endScale;          // Size multiplier reached at the end
+    };
+
+    constexpr std::size_t EFFECT_TYPE_COUNT = static_cast<std::size_t>(EffectType::Count);
+
+    const std::array<EffectPreset, EFFECT_TYPE_COUNT> PRESETS = { {
+        { sf::Vector2f(0.0f, -160.0f), 0.35f, 0.3f },
+        { sf::Vector2f(0.0f, -240.0f), 0.6f,  1.2f },
+        { sf::Vector2f(0.0f, -40.0f),  0.4f,  1.6f },
+    } };
+
+    const EffectPreset& presetFor(EffectType type) {
+        return PRESETS[static_cast<std::size_t>(type)];
+    }
+}
+
+EffectSystem::EffectSystem(const GameTextures& textures)
+    : m_textures(textures)
+    , m_pool(INITIAL_CAPACITY) {
+    m_active.reserve(INITIAL_CAPACITY);
+    for (auto& batch : m_batches) {
+        batch.setPrimitiveType(sf::Triangles);
+    }
+}
+
+EffectSystem::~EffectSystem() {
+    clear();
+}
+
+void EffectSystem::spawn(EffectType type, TextureId texture, sf::Vector2f position, sf::Vector2f size) {
+    Effect* effect = m_pool.acquire();
+    effect->type = type;
+    effect->texture = texture;
+    effect->position = position;
+    effect->size = size;
+    m_active.push_back(effect);
+}
+
+void EffectSystem::update(float deltaTime) {
+    for (std::size_t i = 0; i < m_active.size();) {
+        Effect* effect = m_active[i];
+        const EffectPreset& preset = presetFor(effect->type);
+
+        effect->age += deltaTime;
+        if (effect->age >= preset.lifetime) {
+            m_pool.release(effect);
+            m_active[i] = m_active.back();
+            m_active.pop_back();
+            continue;
+        }
+
+        effect->position += preset.velocity * deltaTime;
+        ++i;
+    }
+}
+
+void EffectSystem::render(sf::RenderTarget& target) {
+    for (auto& batch : m_batches) {
+        batch.clear();
+    }
+
+    for (const Effect* effect : m_active) {
+        const sf::Texture* texture = m_textures.get(effect->texture);
+        if (!texture) {
+            continue;
+        }
+
+        const EffectPreset& preset = presetFor(effect->type);
+        float progress = std::min(effect->age / preset.lifetime, 1.0f);
+        float scale = 1.0f + (preset.endScale - 1.0f) * progress;
+        sf::Color tint(255, 255, 255, static_cast<sf::Uint8>(255.0f * (1.0f - progress)));
+
+        SpriteRenderSystem::appendQuad(m_batches[static_cast<std::size_t>(effect->texture)],
+            effect->position, effect->size * scale, texture->getSize(), tint);
+    }
+
+    for (std::size_t i = 0; i < m_batches.size(); ++i) {
+        if (m_batches[i].getVertexCount() == 0) {
+            continue;
+        }
+
+        sf::RenderStates states;
+        states.texture = m_textures.get(static_cast<TextureId>(i));
+        target.draw(m_batches[i], states);
+    }
+}
+
+void EffectSystem::clear() {
+    for (Effect* effect : m_active) {
+        m_pool.release(effect);
+    }
+    m_active.clear();
+}
@@ -0,0 +1,181 @@
+#include "EnemyAISystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Move towards a point without overshooting it - true once there
+    bool moveTowards(sf::Vector2f& position, sf::Vector2f goal, float distance) {
+        sf::Vector2f offset = goal - position;
+        float length = std::sqrt(offset.x * offset.x + offset.y * offset.y);
+        if (length <= distance) {
+            position = goal;
+            return true;
+        }
+        position += offset * (distance / length);
+        return false;
+    }
+}
+
+EnemyAISystem::EnemyAISystem() {
+    m_due.reserve(64);
+}
+
+void EnemyAISystem::add(World& world, Entity enemy) {
+    const Position* position = world.tryGet<Position>(enemy);
+    const Kind* kind = world.tryGet<Kind>(enemy);
+    if (!position || !kind) {
+        return;
+    }
+
+    EnemyAI ai;
+    ai.home = position->value;
+    ai.state = kind->value == EntityKind::FalconEnemy ? EnemyState::Hover : EnemyState::Patrol;
+    ai.lastTick = m_time;
+    world.add(enemy, ai);
+
+    // Classified on its first tick, next frame
+    schedule(enemy, m_frame + 1);
+    ++m_trackedCount;
+}
+
+void EnemyAISystem::update(World& world, const TileMap& map, const sf::FloatRect& view, Entity target, float deltaTime) {
+    ++m_frame;
+    m_time += deltaTime;
+    m_tickedCount = 0;
+    m_swoopsStarted.clear();
+
+    const Position* targetPosition = world.tryGet<Position>(target);
+    const sf::Vector2f* targetPoint = targetPosition ? &targetPosition->value : nullptr;
+
+    // Take this frame's bucket - enemies re-queued below land in later ones
+    std::vector<Entity>& bucket = m_ring[m_frame % RING_SIZE];
+    m_due.swap(bucket);
+    bucket.clear();
+
+    for (Entity enemy : m_due) {
+        EnemyAI* ai = world.tryGet<EnemyAI>(enemy);
+        Position* position = world.tryGet<Position>(enemy);
+        const Kind* kind = world.tryGet<Kind>(enemy);
+        if (!ai || !position || !kind) {
+            --m_trackedCount;   // Killed or destroyed - drop it from the schedule
+            continue;
+        }
+
+        float step = std::min(static_cast<float>(m_time - ai->lastTick), MAX_TICK);
+        ai->lastTick = m_time;
+
+        int period = periodFor(position->value, view);
+        if (kind->value == EntityKind::FalconEnemy) {
+            fly(enemy, *ai, position->value, targetPoint, period == 1, step);
+        }
+        else {
+            const SpriteComponent* sprite = world.tryGet<SpriteComponent>(enemy);
+            patrol(*ai, position->value, sprite ? sprite->size : sf::Vector2f(), map, step);
+        }
+        ++m_tickedCount;
+
+        // Keep the cadence while the level of detail holds, re-stagger when it changes
+        std::uint64_t next = m_frame + static_cast<std::uint64_t>(period);
+        if (ai->period != period) {
+            next = m_frame + 1 + enemy.index % static_cast<std::uint32_t>(period);
+            ai->period = static_cast<std::uint8_t>(period);
+        }
+        schedule(enemy, next);
+    }
+
+    m_due.clear();
+}
+
+void EnemyAISystem::clear() {
+    for (auto& bucket : m_ring) {
+        bucket.clear();
+    }
+    m_due.clear();
+    m_swoopsStarted.clear();
+    m_trackedCount = 0;
+    m_tickedCount = 0;
+}
+
+void EnemyAISystem::schedule(Entity enemy, std::uint64_t frame) {
+    m_ring[frame % RING_SIZE].push_back(enemy);
+}
+
+int EnemyAISystem::periodFor(sf::Vector2f position, const sf::FloatRect& view) {
+    auto within = [&](float margin) {
+        return position.x >= view.left - margin && position.x <= view.left + view.width + margin
+            && position.y >= view.top - margin && position.y <= view.top + view.height + margin;
+    };
+
+    if (within(ACTIVE_MARGIN)) {
+        return 1;
+    }
+    return within(NEAR_MARGIN) ? NEAR_PERIOD : FAR_PERIOD;
+}
+
+void EnemyAISystem::patrol(EnemyAI& ai, sf::Vector2f& position, sf::Vector2f size, const TileMap& map, float deltaTime) {
+    ai.stateTime += deltaTime;
+
+    float half = size.x / 2.0f;
+    float nextX = position.x + ai.direction * PATROL_SPEED * deltaTime;
+    float front = nextX + ai.direction * half;
+
+    // Turn at the end of the range, at a wall and at a ledge (only when standing on something)
+    sf::Vector2i frontTile = map.toTile(sf::Vector2f(front, position.y));
+    sf::Vector2i underTile = map.toTile(sf::Vector2f(position.x, position.y + size.y / 2.0f + 1.0f));
+    sf::Vector2i frontFloor = map.toTile(sf::Vector2f(front, position.y + size.y / 2.0f + 1.0f));
+    bool standing = map.isSolid(underTile.x, underTile.y);
+
+    bool blocked = std::abs(nextX - ai.home.x) > PATROL_RANGE
+        || map.isSolid(frontTile.x, frontTile.y)
+        || (standing && !map.isSolid(frontFloor.x, frontFloor.y));
+
+    if (blocked) {
+        ai.direction = -ai.direction;
+        ai.stateTime = 0.0f;
+        return;
+    }
+    position.x = nextX;
+}
+
+void EnemyAISystem::fly(Entity falcon, EnemyAI& ai, sf::Vector2f& position, const sf::Vector2f* target, bool onScreen, float deltaTime) {
+    ai.stateTime += deltaTime;
+
+    switch (ai.state) {
+    case EnemyState::Hover: {
+        // Lazy circle around home, squashed vertically
+        float angle = ai.stateTime * HOVER_RATE;
+        position = ai.home + sf::Vector2f(std::cos(angle) * HOVER_RADIUS, std::sin(angle) * HOVER_RADIUS * 0.5f);
+
+        // Only swoop where the player can see it coming
+        if (target && onScreen && ai.stateTime >= SWOOP_COOLDOWN) {
+            sf::Vector2f offset = *target - position;
+            if (std::abs(offset.x) <= SWOOP_REACH_X && offset.y > 0.0f && offset.y <= SWOOP_REACH_Y) {
+                ai.state = EnemyState::Swoop;
+                ai.stateTime = 0.0f;
+                ai.swoopTarget = *target;
+                ai.direction = offset.x < 0.0f ? -1.0f : 1.0f;
+                m_swoopsStarted.push_back(falcon);
+            }
+        }
+        break;
+    }
+    case EnemyState::Swoop:
+        if (moveTowards(position, ai.swoopTarget, SWOOP_SPEED * deltaTime) || ai.stateTime >= SWOOP_TIMEOUT) {
+            ai.state = EnemyState::Return;
+            ai.stateTime = 0.0f;
+        }
+        break;
+    case EnemyState::Return: {
+        // Rejoin the hover circle where it starts
+        sf::Vector2f rejoin = ai.home + sf::Vector2f(HOVER_RADIUS, 0.0f);
+        if (moveTowards(position, rejoin, RETURN_SPEED * deltaTime)) {
+            ai.state = EnemyState::Hover;
+            ai.stateTime = 0.0f;
+        }
+        break;
+    }
+    case EnemyState::Patrol:
+        ai.state = EnemyState::Hover;
+        break;
+    }
+}
@@ -0,0 +1,34 @@
+#include "FrameArena.h"
+#include "Logger.h"
+#include <algorithm>
+
+FrameArena::FrameArena(std::size_t capacity)
+    : m_buffer(allocateBuffer(capacity))
+    , m_capacity(capacity) {
+}
+
+void FrameArena::reset() {
+    m_offset = 0;
+    m_overflow.clear();
+}
+
+FrameArena::Buffer FrameArena::allocateBuffer(std::size_t size) {
+    return Buffer(static_cast<std::byte*>(::operator new[](size ? size : 1, std::align_val_t(ALIGNMENT))));
+}
+
+void* FrameArena::allocateBytes(std::size_t size) {
+    std::size_t start = (m_offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    if (start + size <= m_capacity) {
+        m_offset = start + size;
+        m_peak = std::max(m_peak, m_offset);
+        return m_buffer.get() + start;
+    }
+
+    if (m_overflowCount++ == 0) {
+        Logger::log("Frame arena exhausted (" + std::to_string(m_capacity) + " bytes) - falling back to the heap",
+            LogLevel::Warning);
+    }
+    m_overflow.push_back(allocateBuffer(size));
+    m_peak = std::max(m_peak, start + size);
+    return m_overflow.back().get();
+}
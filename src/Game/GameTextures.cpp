@@ -0,0 +1,48 @@
+#include "GameTextures.h"
+#include "AppContext.h"
+#include "Logger.h"
+
+namespace {
+    constexpr std::array<const char*, TEXTURE_COUNT> FILE_NAMES = {
+        "NoramalBall.png",
+        "MagneticBall.png",
+        "TransparentBall.png",
+        "protection_ball.jpeg",
+        "Coin.png",
+        "RareCoinGidt.png",
+        "Cactus.png",
+        "CloseBox.png",
+        "OpenBox.png",
+        "FalconEnemy.png",
+        "SquareEnemy.png",
+        "SpeedGift.png",
+        "ReverseMovementGift.png",
+        "HeadwindStormGift.png",
+        "LifeHeartGift.png",
+        "ProtectiveShieldGift.png",
+        "heart.png",
+        "background.png",
+    };
+}
+
+void GameTextures::load() {
+    auto& textures = AppContext::instance().textures();
+
+    for (std::size_t i = 0; i < TEXTURE_COUNT; ++i) {
+        try {
+            sf::Texture& texture = textures.getResource(FILE_NAMES[i]);
+            texture.setSmooth(true);
+            if (static_cast<TextureId>(i) == TextureId::Background) {
+                texture.setRepeated(true);   // Scrolled by ParallaxBackground
+            }
+            m_textures[i] = &texture;
+        }
+        catch (const std::exception& e) {
+            Logger::log("Gameplay texture missing: " + std::string(e.what()), LogLevel::Warning);
+        }
+    }
+}
+
+const char* GameTextures::fileName(TextureId id) {
+    return FILE_NAMES[static_cast<std::size_t>(id)];
+}
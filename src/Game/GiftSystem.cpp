@@ -0,0 +1,138 @@
+#include "GiftSystem.h"
+#include <algorithm>
+#include <cmath>
+
+void GiftSystem::collect(World& world, Entity ball, GiftType gift) {
+    switch (gift) {
+    case GiftType::Speed:
+        addModifier(world, ball, ModifierType::Speed, SPEED_DURATION);
+        break;
+    case GiftType::ReverseMovement:
+        addModifier(world, ball, ModifierType::ReverseMovement, REVERSE_DURATION);
+        break;
+    case GiftType::HeadwindStorm:
+        addModifier(world, ball, ModifierType::Headwind, HEADWIND_DURATION);
+        break;
+    case GiftType::ProtectiveShield:
+        addModifier(world, ball, ModifierType::Shield, SHIELD_DURATION);
+        break;
+    case GiftType::LifeHeart:
+        // Instant - no timer
+        if (Ball* state = world.tryGet<Ball>(ball)) {
+            state->lives = std::min(state->lives + 1, MAX_LIVES);
+        }
+        break;
+    }
+}
+
+void GiftSystem::addModifier(World& world, Entity ball, ModifierType type, float duration) {
+    if (!world.isAlive(ball)) {
+        return;
+    }
+
+    Modifiers* modifiers = world.tryGet<Modifiers>(ball);
+    if (!modifiers) {
+        modifiers = world.add(ball, Modifiers{});
+    }
+
+    if (modifiers->count == Modifiers::CAPACITY) {
+        std::size_t soonest = 0;
+        for (std::size_t i = 1; i < modifiers->count; ++i) {
+            if (m_timers.getRemaining(modifiers->entries[i].timer) < m_timers.getRemaining(modifiers->entries[soonest].timer)) {
+                soonest = i;
+            }
+        }
+        m_timers.cancel(modifiers->entries[soonest].timer);
+        removeEntry(*modifiers, soonest);
+    }
+
+    modifiers->entries[modifiers->count++] = Modifiers::Entry{ type, m_timers.schedule(duration, payloadFor(ball)) };
+    ++modifiers->stacks[static_cast<std::size_t>(type)];
+    refreshBall(world, ball, *modifiers);
+}
+
+void GiftSystem::update(World& world, float deltaTime) {
+    m_expired.clear();
+    m_timers.advance(deltaTime, m_expired);
+
+    for (const TimerWheel::Expired& expired : m_expired) {
+        Entity entity = entityFrom(expired.payload);
+        Modifiers* modifiers = world.tryGet<Modifiers>(entity);
+        if (!modifiers) {
+            continue;   // Entity destroyed since - its timers just run out
+        }
+
+        for (std::size_t i = 0; i < modifiers->count; ++i) {
+            if (modifiers->entries[i].timer == expired.id) {
+                removeEntry(*modifiers, i);
+                refreshBall(world, entity, *modifiers);
+                break;
+            }
+        }
+    }
+}
+
+void GiftSystem::clear() {
+    m_timers.clear();
+}
+
+float GiftSystem::getRemaining(World& world, Entity ball, ModifierType type) {
+    const Modifiers* modifiers = world.tryGet<Modifiers>(ball);
+    float remaining = 0.0f;
+    if (modifiers) {
+        for (std::size_t i = 0; i < modifiers->count; ++i) {
+            if (modifiers->entries[i].type == type) {
+                remaining = std::max(remaining, m_timers.getRemaining(modifiers->entries[i].timer));
+            }
+        }
+    }
+    return remaining;
+}
+
+float GiftSystem::speedScale(const Modifiers& modifiers) {
+    float scale = std::pow(SPEED_SCALE_PER_STACK, static_cast<float>(modifiers.stacksOf(ModifierType::Speed)));
+    return std::min(scale, MAX_SPEED_SCALE);
+}
+
+float GiftSystem::headwindAcceleration(const Modifiers& modifiers) {
+    return HEADWIND_ACCELERATION * static_cast<float>(modifiers.stacksOf(ModifierType::Headwind));
+}
+
+std::uint64_t GiftSystem::payloadFor(Entity entity) {
+    return (static_cast<std::uint64_t>(entity.generation) << 32) | entity.index;
+}
+
+Entity GiftSystem::entityFrom(std::uint64_t payload) {
+    return Entity{ static_cast<std::uint32_t>(payload), static_cast<std::uint32_t>(payload >> 32) };
+}
+
+void GiftSystem::refreshBall(World& world, Entity ball, const Modifiers& modifiers) {
+    Ball* state = world.tryGet<Ball>(ball);
+    if (!state) {
+        return;
+    }
+
+    // A shield is the most important thing to show, then the magnet
+    BallType type = BallType::Normal;
+    if (modifiers.stacksOf(ModifierType::Shield) > 0) {
+        type = BallType::Protected;
+    }
+    else if (modifiers.stacksOf(ModifierType::Magnetic) > 0) {
+        type = BallType::Magnetic;
+    }
+    state->type = type;
+
+    if (SpriteComponent* sprite = world.tryGet<SpriteComponent>(ball)) {
+        switch (type) {
+        case BallType::Normal:      sprite->texture = TextureId::NormalBall; break;
+        case BallType::Magnetic:    sprite->texture = TextureId::MagneticBall; break;
+        case BallType::Transparent: sprite->texture = TextureId::TransparentBall; break;
+        case BallType::Protected:   sprite->texture = TextureId::ProtectionBall; break;
+        }
+    }
+}
+
+void GiftSystem::removeEntry(Modifiers& modifiers, std::size_t slot) {
+    --modifiers.stacks[static_cast<std::size_t>(modifiers.entries[slot].type)];
+    modifiers.entries[slot] = modifiers.entries[--modifiers.count];
+}
@@ -0,0 +1,245 @@
+#include "LevelLayout.h"
+#include "TileMap.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <sstream>
+
+namespace {
+    constexpr int MAX_DIMENSION = 1 << 14;
+    constexpr char BALL_CODE = 'P';
+
+    bool isSpawnCode(char code) {
+        return std::isalpha(static_cast<unsigned char>(code)) && code != BALL_CODE;
+    }
+
+    TileType tileFromCode(char code) {
+        switch (code) {
+        case '[': return TileType::LeftEdge;
+        case '(': return TileType::Left;
+        case '=': return TileType::Middle;
+        case ')': return TileType::Right;
+        case ']': return TileType::RightEdge;
+        default:  return TileType::Empty;
+        }
+    }
+
+    // Piece for cell `i` of a '#' ground run - caps on long runs, sides, middle
+    TileType shapedPiece(int i, int length) {
+        if (length == 1) {
+            return TileType::Middle;
+        }
+
+        bool capped = length >= 5;
+        if (capped && i == 0) {
+            return TileType::LeftEdge;
+        }
+        if (capped && i == length - 1) {
+            return TileType::RightEdge;
+        }
+        if (i == (capped ? length - 2 : length - 1)) {
+            return TileType::Right;
+        }
+        if (i == (capped ? 1 : 0)) {
+            return TileType::Left;
+        }
+        return TileType::Middle;
+    }
+
+    void bakeChunk(TileChunk& chunk, const TileColumn& column, int chunkY, int height, const TileAtlas& atlas) {
+        const float chunkSize = TileMap::CHUNK_TILES * TileMap::TILE_SIZE;
+        const int left = column.index * TileMap::CHUNK_TILES;
+        chunk.bounds = sf::FloatRect(left * TileMap::TILE_SIZE, chunkY * chunkSize, chunkSize, chunkSize);
+        chunk.vertices.clear();
+
+        for (int y = chunkY * TileMap::CHUNK_TILES; y < std::min((chunkY + 1) * TileMap::CHUNK_TILES, height); ++y) {
+            for (int localX = 0; localX < TileMap::CHUNK_TILES; ++localX) {
+                TileType type = column.tiles[static_cast<std::size_t>(y) * TileMap::CHUNK_TILES + localX];
+                if (type == TileType::Empty) {
+                    continue;
+                }
+
+                const TileAtlas::Piece& piece = atlas.piece(type);
+                float x = static_cast<float>(left + localX);
+                sf::FloatRect quad((x + piece.left) * TileMap::TILE_SIZE, y * TileMap::TILE_SIZE,
+                    piece.width * TileMap::TILE_SIZE, TileMap::TILE_SIZE);
+                const sf::FloatRect& uv = piece.textureRect;
+
+                sf::Vector2f topLeft(quad.left, quad.top);
+                sf::Vector2f topRight(quad.left + quad.width, quad.top);
+                sf::Vector2f bottomRight(quad.left + quad.width, quad.top + quad.height);
+                sf::Vector2f bottomLeft(quad.left, quad.top + quad.height);
+
+                sf::Vector2f uvTopLeft(uv.left, uv.top);
+                sf::Vector2f uvTopRight(uv.left + uv.width, uv.top);
+                sf::Vector2f uvBottomRight(uv.left + uv.width, uv.top + uv.height);
+                sf::Vector2f uvBottomLeft(uv.left, uv.top + uv.height);
+
+                chunk.vertices.append(sf::Vertex(topLeft, uvTopLeft));
+                chunk.vertices.append(sf::Vertex(topRight, uvTopRight));
+                chunk.vertices.append(sf::Vertex(bottomRight, uvBottomRight));
+                chunk.vertices.append(sf::Vertex(topLeft, uvTopLeft));
+                chunk.vertices.append(sf::Vertex(bottomRight, uvBottomRight));
+                chunk.vertices.append(sf::Vertex(bottomLeft, uvBottomLeft));
+            }
+        }
+    }
+}
+
+bool LevelLayout::parse(std::string_view text) {
+    int width = 0;
+    int height = 0;
+    int y = -1; // -1 until the header was read
+    std::vector<Run> runs;
+    std::vector<std::size_t> rowStarts;
+    std::optional<sf::Vector2i> ballStart;
+    std::uint32_t spawnCount = 0;
+
+    std::size_t lineNumber = 0;
+    while (!text.empty()) {
+        std::size_t end = text.find('\n');
+        std::string_view line = text.substr(0, end);
+        text = (end == std::string_view::npos) ? std::string_view() : text.substr(end + 1);
+        ++lineNumber;
+
+        while (!line.empty() && std::isspace(static_cast<unsigned char>(line.back()))) {
+            line.remove_suffix(1);
+        }
+        if (line.empty() || (y < 0 && line.front() == '#')) {
+            continue;
+        }
+
+        if (y < 0) {
+            int version = 0;
+            std::istringstream header{ std::string(line) };
+            std::string magic;
+            if (!(header >> magic >> version >> width >> height) || magic != "DBLV" ||
+                width <= 0 || height <= 0 || width > MAX_DIMENSION || height > MAX_DIMENSION) {
+                Logger::log("Level header invalid at line " + std::to_string(lineNumber), LogLevel::Error);
+                return false;
+            }
+            if (version > FORMAT_VERSION) {
+                Logger::log("Level format version " + std::to_string(version) + " is newer than supported", LogLevel::Error);
+                return false;
+            }
+
+            y = 0;
+            continue;
+        }
+
+        if (y >= height) {
+            Logger::log("Level has more rows than its header declares (line " + std::to_string(lineNumber) + ")", LogLevel::Error);
+            return false;
+        }
+
+        // Split "[count]<char>" runs, merging neighbours of the same character
+        rowStarts.push_back(runs.size());
+        int cells = 0;
+        std::size_t i = 0;
+        bool valid = true;
+        while (i < line.size()) {
+            int count = 1;
+            if (std::isdigit(static_cast<unsigned char>(line[i]))) {
+                auto [next, error] = std::from_chars(line.data() + i, line.data() + line.size(), count);
+                if (error != std::errc() || count <= 0) {
+                    valid = false;
+                    break;
+                }
+                i = static_cast<std::size_t>(next - line.data());
+            }
+            if (i >= line.size() || count > width - cells) {
+                valid = false;
+                break;
+            }
+
+            char code = line[i++];
+            if (code == BALL_CODE && !ballStart) {
+                ballStart = sf::Vector2i(cells, y);
+            }
+            if (runs.size() > rowStarts.back() && runs.back().code == code) {
+                runs.back().length += count;
+            }
+            else {
+                runs.push_back(Run{ cells, count, code, spawnCount });
+            }
+            if (isSpawnCode(code)) {
+                spawnCount += static_cast<std::uint32_t>(count);
+            }
+            cells += count;
+        }
+
+        if (!valid || cells != width) {
+            Logger::log("Level row " + std::to_string(y) + " does not decode to " + std::to_string(width) +
+                " cells (line " + std::to_string(lineNumber) + ")", LogLevel::Error);
+            return false;
+        }
+        ++y;
+    }
+
+    if (y != height) {
+        Logger::log("Level has " + std::to_string(std::max(y, 0)) + " rows, expected " + std::to_string(height), LogLevel::Error);
+        return false;
+    }
+
+    rowStarts.push_back(runs.size());
+    m_width = width;
+    m_height = height;
+    m_runs = std::move(runs);
+    m_rowStarts = std::move(rowStarts);
+    m_ballStart = ballStart;
+    m_spawnCount = spawnCount;
+    return true;
+}
+
+std::unique_ptr<TileColumn> LevelLayout::buildColumn(int column, const TileAtlas& atlas) const {
+    if (column < 0 || column >= getColumnCount()) {
+        return nullptr;
+    }
+
+    auto result = std::make_unique<TileColumn>();
+    result->index = column;
+    result->tiles.assign(static_cast<std::size_t>(TileMap::CHUNK_TILES) * m_height, TileType::Empty);
+
+    const int left = column * TileMap::CHUNK_TILES;
+    const int right = std::min(left + TileMap::CHUNK_TILES, m_width);
+
+    for (int y = 0; y < m_height; ++y) {
+        auto rowBegin = m_runs.begin() + static_cast<std::ptrdiff_t>(m_rowStarts[y]);
+        auto rowEnd = m_runs.begin() + static_cast<std::ptrdiff_t>(m_rowStarts[y + 1]);
+
+        // First run reaching into the column
+        auto run = std::upper_bound(rowBegin, rowEnd, left, [](int x, const Run& candidate) {
+            return x < candidate.start + candidate.length;
+        });
+
+        TileType* row = &result->tiles[static_cast<std::size_t>(y) * TileMap::CHUNK_TILES];
+        for (; run != rowEnd && run->start < right; ++run) {
+            int from = std::max(run->start, left);
+            int to = std::min(run->start + run->length, right);
+            for (int x = from; x < to; ++x) {
+                if (run->code == '#') {
+                    row[x - left] = shapedPiece(x - run->start, run->length);
+                }
+                else if (isSpawnCode(run->code)) {
+                    auto id = run->firstSpawn + static_cast<std::uint32_t>(x - run->start);
+                    result->spawns.push_back(LevelSpawn{ run->code, sf::Vector2i(x, y), id });
+                }
+                else {
+                    row[x - left] = tileFromCode(run->code);
+                }
+            }
+        }
+    }
+
+    int chunkRows = (m_height + TileMap::CHUNK_TILES - 1) / TileMap::CHUNK_TILES;
+    result->chunks.resize(static_cast<std::size_t>(chunkRows));
+    for (int cy = 0; cy < chunkRows; ++cy) {
+        bakeChunk(result->chunks[static_cast<std::size_t>(cy)], *result, cy, m_height, atlas);
+    }
+    return result;
+}
+
+int LevelLayout::getColumnCount() const {
+    return (m_width + TileMap::CHUNK_TILES - 1) / TileMap::CHUNK_TILES;
+}
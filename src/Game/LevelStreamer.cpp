@@ -0,0 +1,196 @@
+#include "LevelStreamer.h"
+#include <algorithm>
+
+LevelStreamer::LevelStreamer(TileMap& map, const TileAtlas& atlas, std::size_t workerCount)
+    : m_map(map)
+    , m_atlas(atlas)
+    , m_workerCount(std::max<std::size_t>(1, workerCount)) {
+}
+
+LevelStreamer::~LevelStreamer() {
+    // Queued requests are dropped; a worker mid-build finishes that column first
+    for (auto& worker : m_workers) {
+        worker.request_stop();
+    }
+    m_requestReady.notify_all();
+}
+
+void LevelStreamer::prime(const sf::FloatRect& view) {
+    // Starts streaming the map's current layout - workers only run after this
+    m_layout = m_map.getLayout();
+    m_states.assign(static_cast<std::size_t>(m_map.getColumnCount()), ColumnState::Unloaded);
+    m_active.clear();
+    m_arrivedSpawns.clear();
+    m_droppedColumns.clear();
+    if (!m_layout) {
+        m_spawnStates.clear();
+        return;
+    }
+
+    m_spawnStates.assign(m_layout->getSpawnCount(), SpawnState::Fresh);
+    sf::Vector2i range = columnRange(view, LOAD_MARGIN, m_map.getColumnCount());
+    for (int column = range.x; column <= range.y; ++column) {
+        m_states[static_cast<std::size_t>(column)] = ColumnState::Requested;
+        m_active.push_back(column);
+        adopt(m_layout->buildColumn(column, m_atlas));
+    }
+}
+
+void LevelStreamer::update(const sf::FloatRect& view) {
+    m_arrivedSpawns.clear();
+    m_droppedColumns.clear();
+    if (!m_layout) {
+        return;
+    }
+
+    collectFinished();
+
+    const int columnCount = m_map.getColumnCount();
+    sf::Vector2i keep = columnRange(view, UNLOAD_MARGIN, columnCount);
+    for (std::size_t i = 0; i < m_active.size();) {
+        int column = m_active[i];
+        if (column < keep.x || column > keep.y) {
+            drop(column);
+            m_active[i] = m_active.back();
+            m_active.pop_back();
+        }
+        else {
+            ++i;
+        }
+    }
+
+    // Nearest columns first, so the ones about to be seen are built first
+    sf::Vector2i load = columnRange(view, LOAD_MARGIN, columnCount);
+    sf::Vector2i visible = columnRange(view, 0, columnCount);
+    int center = (visible.x + visible.y) / 2;
+    for (int distance = 0; distance <= std::max(center - load.x, load.y - center); ++distance) {
+        for (int column : { center - distance, center + distance }) {
+            if (column >= load.x && column <= load.y && m_states[static_cast<std::size_t>(column)] == ColumnState::Unloaded) {
+                request(column);
+            }
+            if (distance == 0) {
+                break;
+            }
+        }
+    }
+
+    // A column on screen that has not arrived yet is built here rather than shown as a hole
+    for (int column = visible.x; column <= visible.y; ++column) {
+        auto& state = m_states[static_cast<std::size_t>(column)];
+        if (state != ColumnState::Resident) {
+            if (state == ColumnState::Unloaded) {
+                m_active.push_back(column);
+            }
+            state = ColumnState::Requested;
+            adopt(m_layout->buildColumn(column, m_atlas));
+            ++m_mainThreadBuilds;
+        }
+    }
+}
+
+void LevelStreamer::setSpawnState(std::uint32_t spawnId, SpawnState state) {
+    if (spawnId < m_spawnStates.size()) {
+        m_spawnStates[spawnId] = state;
+    }
+}
+
+SpawnState LevelStreamer::getSpawnState(std::uint32_t spawnId) const {
+    return spawnId < m_spawnStates.size() ? m_spawnStates[spawnId] : SpawnState::Fresh;
+}
+
+std::size_t LevelStreamer::defaultWorkerCount() {
+    // Building a column is a few microseconds of decoding - one worker keeps well
+    // ahead of the camera, a second helps when a respawn needs several at once
+    return std::thread::hardware_concurrency() > 3 ? 2 : 1;
+}
+
+void LevelStreamer::request(int column) {
+    m_states[static_cast<std::size_t>(column)] = ColumnState::Requested;
+    m_active.push_back(column);
+    ++m_inFlight;
+    {
+        std::lock_guard lock(m_requestMutex);
+        m_requests.push_back(column);
+    }
+
+    if (m_workers.empty()) {
+        for (std::size_t i = 0; i < m_workerCount; ++i) {
+            m_workers.emplace_back([this](std::stop_token stopToken) { workerLoop(stopToken); });
+        }
+    }
+
+    m_requestReady.notify_one();
+}
+
+void LevelStreamer::adopt(std::unique_ptr<TileColumn> column) {
+    if (!column) {
+        return;
+    }
+
+    // Dropped while it was being built, or already built on the main thread
+    auto& state = m_states[static_cast<std::size_t>(column->index)];
+    if (state != ColumnState::Requested) {
+        return;
+    }
+
+    state = ColumnState::Resident;
+    m_arrivedSpawns.insert(m_arrivedSpawns.end(), column->spawns.begin(), column->spawns.end());
+    m_map.setColumn(std::move(column));
+}
+
+void LevelStreamer::drop(int column) {
+    auto& state = m_states[static_cast<std::size_t>(column)];
+    if (state == ColumnState::Resident) {
+        m_map.releaseColumn(column);
+        m_droppedColumns.push_back(column);
+    }
+    else if (state == ColumnState::Requested) {
+        // Not started yet - take it back; otherwise its result is discarded on arrival
+        std::lock_guard lock(m_requestMutex);
+        auto it = std::find(m_requests.begin(), m_requests.end(), column);
+        if (it != m_requests.end()) {
+            m_requests.erase(it);
+            --m_inFlight;
+        }
+    }
+    state = ColumnState::Unloaded;
+}
+
+void LevelStreamer::collectFinished() {
+    std::unique_ptr<TileColumn> column;
+    while (m_finished.tryPop(column)) {
+        --m_inFlight;
+        adopt(std::move(column));
+        column.reset();
+    }
+}
+
+void LevelStreamer::workerLoop(std::stop_token stopToken) {
+    while (true) {
+        int column = 0;
+        {
+            std::unique_lock lock(m_requestMutex);
+            if (!m_requestReady.wait(lock, stopToken, [this] { return !m_requests.empty(); })) {
+                return; // Stop requested
+            }
+            column = m_requests.front();
+            m_requests.pop_front();
+        }
+
+        std::unique_ptr<TileColumn> built = m_layout->buildColumn(column, m_atlas);
+
+        // The queue only fills up if the main thread stalls - wait for it without locking
+        while (!m_finished.tryPush(std::move(built))) {
+            if (stopToken.stop_requested()) {
+                return;
+            }
+            std::this_thread::yield();
+        }
+    }
+}
+
+sf::Vector2i LevelStreamer::columnRange(const sf::FloatRect& view, int margin, int columnCount) {
+    int first = std::max(TileMap::columnOf(view.left) - margin, 0);
+    int last = std::min(TileMap::columnOf(view.left + view.width) + margin, columnCount - 1);
+    return sf::Vector2i(first, last);
+}
@@ -0,0 +1,122 @@
+#include "MagnetKernel.h"
+#include "Simd.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Below this distance the coin is at the centre - also avoids dividing by zero
+    constexpr float MIN_DISTANCE = 1e-3f;
+}
+
+void MagnetKernel::pullScalar(float* xs, float* ys, std::size_t count, const MagnetField& field, float deltaTime) {
+    const float radiusSquared = field.radius * field.radius;
+    const float inverseRadius = 1.0f / field.radius;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        float dx = field.centerX - xs[i];
+        float dy = field.centerY - ys[i];
+        float distanceSquared = dx * dx + dy * dy;
+        if (distanceSquared >= radiusSquared || distanceSquared <= MIN_DISTANCE * MIN_DISTANCE) {
+            continue;
+        }
+
+        float distance = std::sqrt(distanceSquared);
+        float closeness = 1.0f - distance * inverseRadius;
+        float speed = field.pullSpeed + (field.coreSpeed - field.pullSpeed) * closeness;
+        float scale = std::min(speed * deltaTime, distance) / distance;
+        xs[i] += dx * scale;
+        ys[i] += dy * scale;
+    }
+}
+
+#if defined(GAME_SIMD_AVX)
+
+void MagnetKernel::pull(float* xs, float* ys, std::size_t count, const MagnetField& field, float deltaTime) {
+    const __m256 centerX = _mm256_set1_ps(field.centerX);
+    const __m256 centerY = _mm256_set1_ps(field.centerY);
+    const __m256 radiusSquared = _mm256_set1_ps(field.radius * field.radius);
+    const __m256 minDistanceSquared = _mm256_set1_ps(MIN_DISTANCE * MIN_DISTANCE);
+    const __m256 inverseRadius = _mm256_set1_ps(1.0f / field.radius);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 pullStep = _mm256_set1_ps(field.pullSpeed * deltaTime);
+    const __m256 coreStep = _mm256_set1_ps((field.coreSpeed - field.pullSpeed) * deltaTime);
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 x = _mm256_loadu_ps(xs + i);
+        __m256 y = _mm256_loadu_ps(ys + i);
+        __m256 dx = _mm256_sub_ps(centerX, x);
+        __m256 dy = _mm256_sub_ps(centerY, y);
+        __m256 distanceSquared = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        __m256 inside = _mm256_and_ps(
+            _mm256_cmp_ps(distanceSquared, radiusSquared, _CMP_LT_OQ),
+            _mm256_cmp_ps(distanceSquared, minDistanceSquared, _CMP_GT_OQ));
+
+        __m256 distance = _mm256_sqrt_ps(distanceSquared);
+        __m256 closeness = _mm256_sub_ps(one, _mm256_mul_ps(distance, inverseRadius));
+        __m256 step = _mm256_add_ps(pullStep, _mm256_mul_ps(coreStep, closeness));
+        // Lanes outside the field divide by zero here - the mask discards them
+        __m256 scale = _mm256_and_ps(_mm256_div_ps(_mm256_min_ps(step, distance), distance), inside);
+
+        _mm256_storeu_ps(xs + i, _mm256_add_ps(x, _mm256_mul_ps(dx, scale)));
+        _mm256_storeu_ps(ys + i, _mm256_add_ps(y, _mm256_mul_ps(dy, scale)));
+    }
+
+    pullScalar(xs + i, ys + i, count - i, field, deltaTime);
+}
+
+const char* MagnetKernel::getInstructionSet() {
+    return "AVX";
+}
+
+#elif defined(GAME_SIMD_SSE2)
+
+void MagnetKernel::pull(float* xs, float* ys, std::size_t count, const MagnetField& field, float deltaTime) {
+    const __m128 centerX = _mm_set1_ps(field.centerX);
+    const __m128 centerY = _mm_set1_ps(field.centerY);
+    const __m128 radiusSquared = _mm_set1_ps(field.radius * field.radius);
+    const __m128 minDistanceSquared = _mm_set1_ps(MIN_DISTANCE * MIN_DISTANCE);
+    const __m128 inverseRadius = _mm_set1_ps(1.0f / field.radius);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 pullStep = _mm_set1_ps(field.pullSpeed * deltaTime);
+    const __m128 coreStep = _mm_set1_ps((field.coreSpeed - field.pullSpeed) * deltaTime);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x = _mm_loadu_ps(xs + i);
+        __m128 y = _mm_loadu_ps(ys + i);
+        __m128 dx = _mm_sub_ps(centerX, x);
+        __m128 dy = _mm_sub_ps(centerY, y);
+        __m128 distanceSquared = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        __m128 inside = _mm_and_ps(
+            _mm_cmplt_ps(distanceSquared, radiusSquared),
+            _mm_cmpgt_ps(distanceSquared, minDistanceSquared));
+
+        __m128 distance = _mm_sqrt_ps(distanceSquared);
+        __m128 closeness = _mm_sub_ps(one, _mm_mul_ps(distance, inverseRadius));
+        __m128 step = _mm_add_ps(pullStep, _mm_mul_ps(coreStep, closeness));
+        // Lanes outside the field divide by zero here - the mask discards them
+        __m128 scale = _mm_and_ps(_mm_div_ps(_mm_min_ps(step, distance), distance), inside);
+
+        _mm_storeu_ps(xs + i, _mm_add_ps(x, _mm_mul_ps(dx, scale)));
+        _mm_storeu_ps(ys + i, _mm_add_ps(y, _mm_mul_ps(dy, scale)));
+    }
+
+    pullScalar(xs + i, ys + i, count - i, field, deltaTime);
+}
+
+const char* MagnetKernel::getInstructionSet() {
+    return "SSE2";
+}
+
+#else
+
+void MagnetKernel::pull(float* xs, float* ys, std::size_t count, const MagnetField& field, float deltaTime) {
+    pullScalar(xs, ys, count, field, deltaTime);
+}
+
+const char* MagnetKernel::getInstructionSet() {
+    return "scalar";
+}
+
+#endif
@@ -0,0 +1,50 @@
+#include "MagnetSystem.h"
+#include "Components.h"
+#include "MagnetKernel.h"
+
+void MagnetSystem::update(World& world, const SpatialHash& broadPhase, FrameArena& arena, float deltaTime) {
+    auto& balls = world.pool<Ball>();
+    auto& modifiers = world.pool<Modifiers>();
+    auto& positions = world.pool<Position>();
+    auto& kinds = world.pool<Kind>();
+
+    m_lastGatheredCount = 0;
+
+    auto owners = balls.entities();
+    auto values = balls.components();
+    for (std::size_t b = 0; b < values.size(); ++b) {
+        const Position* ballPosition = positions.tryGet(owners[b].index);
+        const Modifiers* ballModifiers = modifiers.tryGet(owners[b].index);
+        if (!ballPosition || !ballModifiers || ballModifiers->stacksOf(ModifierType::Magnetic) == 0) {
+            continue;
+        }
+
+        MagnetField field{ ballPosition->value.x, ballPosition->value.y, FIELD_RADIUS, PULL_SPEED, CORE_SPEED };
+        broadPhase.query(sf::FloatRect(ballPosition->value.x - FIELD_RADIUS, ballPosition->value.y - FIELD_RADIUS,
+            FIELD_RADIUS * 2.0f, FIELD_RADIUS * 2.0f), m_candidates);
+
+        // Gather into structure-of-arrays form for the kernel
+        auto coins = arena.allocate<Entity>(m_candidates.size());
+        auto xs = arena.allocate<float>(m_candidates.size());
+        auto ys = arena.allocate<float>(m_candidates.size());
+        std::size_t count = 0;
+        for (Entity candidate : m_candidates) {
+            const Kind* kind = kinds.tryGet(candidate.index);
+            const Position* position = positions.tryGet(candidate.index);
+            if (!kind || !position || (kind->value != EntityKind::Coin && kind->value != EntityKind::RareCoin)) {
+                continue;
+            }
+            coins[count] = candidate;
+            xs[count] = position->value.x;
+            ys[count] = position->value.y;
+            ++count;
+        }
+
+        MagnetKernel::pull(xs.data(), ys.data(), count, field, deltaTime);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            positions.tryGet(coins[i].index)->value = sf::Vector2f(xs[i], ys[i]);
+        }
+        m_lastGatheredCount += count;
+    }
+}
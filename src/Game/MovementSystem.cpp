@@ -0,0 +1,21 @@
+#include "MovementSystem.h"
+#include "Components.h"
+
+void MovementSystem::update(World& world, float deltaTime) {
+    auto& velocities = world.pool<Velocity>();
+    auto& positions = world.pool<Position>();
+    auto& circles = world.pool<CircleCollider>();
+
+    // Velocity is the smaller pool (static coins and cacti have none) - drive the loop from it
+    auto owners = velocities.entities();
+    auto values = velocities.components();
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        // Balls are swept by PhysicsSystem so they cannot tunnel through terrain
+        if (circles.has(owners[i].index)) {
+            continue;
+        }
+        if (Position* position = positions.tryGet(owners[i].index)) {
+            position->value += values[i].value * deltaTime;
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#include "ParallaxBackground.h"
+#include <cmath>
+
+void ParallaxBackground::render(sf::RenderTarget& target, sf::Vector2f canvasSize, float cameraX) {
+    if (!m_texture || canvasSize.y <= 0.0f) {
+        return;
+    }
+
+    sf::Vector2f textureSize(m_texture->getSize());
+    if (textureSize.x <= 0.0f || textureSize.y <= 0.0f) {
+        return;
+    }
+
+    // Texture pixels per canvas pixel, keeping the aspect ratio
+    float scale = textureSize.y / canvasSize.y;
+
+    // Wrap the offset into one texture width so the coordinates stay small and precise
+    float left = std::fmod(cameraX * m_factor * scale, textureSize.x);
+    if (left < 0.0f) {
+        left += textureSize.x;
+    }
+    float right = left + canvasSize.x * scale;
+
+    m_quad[0] = sf::Vertex(sf::Vector2f(0.0f, 0.0f), sf::Vector2f(left, 0.0f));
+    m_quad[1] = sf::Vertex(sf::Vector2f(canvasSize.x, 0.0f), sf::Vector2f(right, 0.0f));
+    m_quad[2] = sf::Vertex(sf::Vector2f(canvasSize.x, canvasSize.y), sf::Vector2f(right, textureSize.y));
+    m_quad[3] = m_quad[0];
+    m_quad[4] = m_quad[2];
+    m_quad[5] = sf::Vertex(sf::Vector2f(0.0f, canvasSize.y), sf::Vector2f(left, textureSize.y));
+
+    sf::RenderStates states;
+    states.texture = m_texture;
+    target.draw(m_quad, states);
+}
@@ -0,0 +1,372 @@
+#include "ParticleSystem.h"
+#include "Simd.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float PI = 3.14159265f;
+    constexpr unsigned int DOT_TEXTURE_SIZE = 32;
+
+    struct ParticlePreset {
+        std::uint8_t texture;        // ParticleSystem::Texture
+        int burstCount;              // Particles per burst()
+        float emitRate;              // Particles per second per emitter
+        float minLifetime, maxLifetime;
+        float minSpeed, maxSpeed;
+        float direction, spread;     // Launch angle and +- range, radians (0 = right, y down)
+        sf::Vector2f acceleration;
+        float startSize, endSize;
+        sf::Color startColor, endColor;
+        bool fadeIn;                 // Alpha rises then falls instead of only falling
+    };
+
+    constexpr std::size_t EFFECT_COUNT = static_cast<std::size_t>(ParticleEffect::Count);
+
+    const std::array<ParticlePreset, EFFECT_COUNT> PRESETS = { {
+        // Dust
+        { 0, 0, 90.0f, 3.0f, 5.0f, 30.0f, 70.0f, PI, 0.35f, sf::Vector2f(0.0f, 4.0f),
+          5.0f, 9.0f, sf::Color(222, 190, 140, 110), sf::Color(222, 190, 140, 0), true },
+        // Sandstorm
+        { 0, 0, 2400.0f, 1.2f, 2.2f, 520.0f, 820.0f, PI, 0.12f, sf::Vector2f(-60.0f, 25.0f),
+          4.0f, 7.0f, sf::Color(214, 176, 120, 170), sf::Color(190, 150, 100, 0), true },
+        // CoinSparkle
+        { 0, 24, 0.0f, 0.3f, 0.6f, 60.0f, 220.0f, -PI / 2.0f, PI, sf::Vector2f(0.0f, 280.0f),
+          7.0f, 1.0f, sf::Color(255, 236, 120, 255), sf::Color(255, 190, 40, 0), false },
+        // CoinBurst
+        { 1, 10, 0.0f, 0.6f, 0.9f, 180.0f, 340.0f, -PI / 2.0f, 0.9f, sf::Vector2f(0.0f, 900.0f),
+          14.0f, 10.0f, sf::Color(255, 255, 255, 255), sf::Color(255, 255, 255, 0), false },
+        // Explosion
+        { 0, 90, 0.0f, 0.35f, 0.9f, 80.0f, 420.0f, 0.0f, PI, sf::Vector2f(0.0f, -120.0f),
+          10.0f, 26.0f, sf::Color(255, 200, 80, 255), sf::Color(90, 80, 70, 0), false },
+    } };
+
+    const ParticlePreset& presetFor(ParticleEffect effect) {
+        return PRESETS[static_cast<std::size_t>(effect)];
+    }
+
+    sf::Uint8 lerp(sf::Uint8 from, sf::Uint8 to, float t) {
+        return static_cast<sf::Uint8>(from + (static_cast<float>(to) - from) * t);
+    }
+
+    // v += a * dt; p += v * dt; age += dt - over [begin, end) of each array
+    void integrate(float* x, float* y, float* vx, float* vy, const float* ax, const float* ay, float* age,
+        std::size_t begin, std::size_t end, float deltaTime) {
+        std::size_t i = begin;
+
+#if defined(GAME_SIMD_AVX)
+        const __m256 dt = _mm256_set1_ps(deltaTime);
+        for (; i + 8 <= end; i += 8) {
+            __m256 velocityX = _mm256_add_ps(_mm256_loadu_ps(vx + i), _mm256_mul_ps(_mm256_loadu_ps(ax + i), dt));
+            __m256 velocityY = _mm256_add_ps(_mm256_loadu_ps(vy + i), _mm256_mul_ps(_mm256_loadu_ps(ay + i), dt));
+            _mm256_storeu_ps(vx + i, velocityX);
+            _mm256_storeu_ps(vy + i, velocityY);
+            _mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_loadu_ps(x + i), _mm256_mul_ps(velocityX, dt)));
+            _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(velocityY, dt)));
+            _mm256_storeu_ps(age + i, _mm256_add_ps(_mm256_loadu_ps(age + i), dt));
+        }
+#elif defined(GAME_SIMD_SSE2)
+        const __m128 dt = _mm_set1_ps(deltaTime);
+        for (; i + 4 <= end; i += 4) {
+            __m128 velocityX = _mm_add_ps(_mm_loadu_ps(vx + i), _mm_mul_ps(_mm_loadu_ps(ax + i), dt));
+            __m128 velocityY = _mm_add_ps(_mm_loadu_ps(vy + i), _mm_mul_ps(_mm_loadu_ps(ay + i), dt));
+            _mm_storeu_ps(vx + i, velocityX);
+            _mm_storeu_ps(vy + i, velocityY);
+            _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(velocityX, dt)));
+            _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(velocityY, dt)));
+            _mm_storeu_ps(age + i, _mm_add_ps(_mm_loadu_ps(age + i), dt));
+        }
+#endif
+
+        for (; i < end; ++i) {
+            vx[i] += ax[i] * deltaTime;
+            vy[i] += ay[i] * deltaTime;
+            x[i] += vx[i] * deltaTime;
+            y[i] += vy[i] * deltaTime;
+            age[i] += deltaTime;
+        }
+    }
+}
+
+ParticleSystem::ParticleSystem(const GameTextures& textures)
+    : m_textures(textures)
+    , m_random(std::random_device{}()) {
+    for (Buffer& buffer : m_buffers) {
+        for (auto* attribute : { &buffer.x, &buffer.y, &buffer.vx, &buffer.vy, &buffer.ax, &buffer.ay, &buffer.age, &buffer.lifetime }) {
+            attribute->resize(MAX_PARTICLES);
+        }
+        buffer.effect.resize(MAX_PARTICLES);
+    }
+    createDotTexture();
+}
+
+ParticleSystem::~ParticleSystem() {
+    setWorkerCount(0);
+}
+
+void ParticleSystem::burst(ParticleEffect effect, sf::Vector2f position) {
+    for (int i = 0; i < presetFor(effect).burstCount; ++i) {
+        emit(effect, position);
+    }
+}
+
+EmitterId ParticleSystem::addEmitter(ParticleEffect effect, const sf::FloatRect& area) {
+    for (std::size_t i = 0; i < m_emitters.size(); ++i) {
+        if (!m_emitters[i].active) {
+            m_emitters[i] = Emitter{ effect, area, 0.0f, true };
+            return static_cast<EmitterId>(i);
+        }
+    }
+
+    Logger::log("All particle emitters in use", LogLevel::Warning);
+    return NO_EMITTER;
+}
+
+void ParticleSystem::setEmitterArea(EmitterId emitter, const sf::FloatRect& area) {
+    if (emitter >= 0 && static_cast<std::size_t>(emitter) < m_emitters.size()) {
+        m_emitters[emitter].area = area;
+    }
+}
+
+void ParticleSystem::removeEmitter(EmitterId emitter) {
+    // Particles already emitted live out their lifetime
+    if (emitter >= 0 && static_cast<std::size_t>(emitter) < m_emitters.size()) {
+        m_emitters[emitter].active = false;
+    }
+}
+
+void ParticleSystem::update(float deltaTime) {
+    for (Emitter& emitter : m_emitters) {
+        if (!emitter.active) {
+            continue;
+        }
+
+        emitter.pending += presetFor(emitter.effect).emitRate * deltaTime;
+        for (; emitter.pending >= 1.0f; emitter.pending -= 1.0f) {
+            emit(emitter.effect, sf::Vector2f(
+                emitter.area.left + random(0.0f, emitter.area.width),
+                emitter.area.top + random(0.0f, emitter.area.height)));
+        }
+    }
+
+    if (m_workers.empty() || getParticleCount() < PARALLEL_MIN_PARTICLES) {
+        integrateSlice(0, 1, deltaTime);
+    }
+    else {
+        std::latch done(static_cast<std::ptrdiff_t>(m_workers.size()));
+        {
+            std::lock_guard<std::mutex> lock(m_jobMutex);
+            m_jobDelta = deltaTime;
+            m_jobDone = &done;
+            ++m_jobGeneration;
+        }
+        m_jobReady.notify_all();
+
+        integrateSlice(0, m_workers.size() + 1, deltaTime);
+        done.wait();
+    }
+
+    for (Buffer& buffer : m_buffers) {
+        removeExpired(buffer);
+    }
+}
+
+void ParticleSystem::render(sf::RenderTarget& target) {
+    const sf::View& view = target.getView();
+    sf::FloatRect visible(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+
+    for (std::size_t slot = 0; slot < m_buffers.size(); ++slot) {
+        Buffer& buffer = m_buffers[slot];
+        const sf::Texture* texture = textureFor(static_cast<Texture>(slot));
+        if (buffer.count == 0 || !texture) {
+            continue;
+        }
+
+        sf::Vector2f textureSize(texture->getSize());
+        buffer.vertices.resize(buffer.count * 6);   // Shrinking keeps the capacity
+        std::size_t written = 0;
+
+        for (std::size_t i = 0; i < buffer.count; ++i) {
+            const ParticlePreset& preset = presetFor(buffer.effect[i]);
+            float progress = std::min(buffer.age[i] / buffer.lifetime[i], 1.0f);
+            float half = (preset.startSize + (preset.endSize - preset.startSize) * progress) * 0.5f;
+
+            float x = buffer.x[i];
+            float y = buffer.y[i];
+            if (x + half < visible.left || x - half > visible.left + visible.width ||
+                y + half < visible.top || y - half > visible.top + visible.height) {
+                continue;
+            }
+
+            sf::Color color(
+                lerp(preset.startColor.r, preset.endColor.r, progress),
+                lerp(preset.startColor.g, preset.endColor.g, progress),
+                lerp(preset.startColor.b, preset.endColor.b, progress),
+                lerp(preset.startColor.a, preset.endColor.a, progress));
+            if (preset.fadeIn) {
+                color.a = static_cast<sf::Uint8>(preset.startColor.a * std::sin(progress * PI));
+            }
+
+            sf::Vertex* quad = &buffer.vertices[written];
+            quad[0] = sf::Vertex(sf::Vector2f(x - half, y - half), color, sf::Vector2f(0.0f, 0.0f));
+            quad[1] = sf::Vertex(sf::Vector2f(x + half, y - half), color, sf::Vector2f(textureSize.x, 0.0f));
+            quad[2] = sf::Vertex(sf::Vector2f(x + half, y + half), color, textureSize);
+            quad[3] = quad[0];
+            quad[4] = quad[2];
+            quad[5] = sf::Vertex(sf::Vector2f(x - half, y + half), color, sf::Vector2f(0.0f, textureSize.y));
+            written += 6;
+        }
+
+        buffer.vertices.resize(written);
+        if (written > 0) {
+            target.draw(buffer.vertices, sf::RenderStates(texture));
+        }
+    }
+}
+
+void ParticleSystem::clear() {
+    for (Buffer& buffer : m_buffers) {
+        buffer.count = 0;
+    }
+    for (Emitter& emitter : m_emitters) {
+        emitter.active = false;
+    }
+}
+
+void ParticleSystem::setWorkerCount(std::size_t workerCount) {
+    for (auto& worker : m_workers) {
+        worker.request_stop();
+    }
+    m_jobReady.notify_all();
+    m_workers.clear();   // Joins
+
+    // Read here, not on the new thread - a job posted before it first locks would count as seen
+    std::uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        generation = m_jobGeneration;
+    }
+
+    m_workers.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back([this, slice = i + 1, generation](std::stop_token stopToken) {
+            workerLoop(stopToken, slice, generation);
+        });
+    }
+}
+
+std::size_t ParticleSystem::defaultWorkerCount() {
+    // Leave a core for rendering and one for the audio/loader threads
+    unsigned int hardware = std::thread::hardware_concurrency();
+    return std::clamp<std::size_t>(hardware > 3 ? hardware - 3 : 0, 0, 3);
+}
+
+std::size_t ParticleSystem::getParticleCount() const {
+    std::size_t count = 0;
+    for (const Buffer& buffer : m_buffers) {
+        count += buffer.count;
+    }
+    return count;
+}
+
+void ParticleSystem::emit(ParticleEffect effect, sf::Vector2f position) {
+    const ParticlePreset& preset = presetFor(effect);
+    Buffer& buffer = m_buffers[preset.texture];
+    if (buffer.count >= MAX_PARTICLES) {
+        return;
+    }
+
+    float angle = preset.direction + random(-preset.spread, preset.spread);
+    float speed = random(preset.minSpeed, preset.maxSpeed);
+
+    std::size_t i = buffer.count++;
+    buffer.x[i] = position.x;
+    buffer.y[i] = position.y;
+    buffer.vx[i] = std::cos(angle) * speed;
+    buffer.vy[i] = std::sin(angle) * speed;
+    buffer.ax[i] = preset.acceleration.x;
+    buffer.ay[i] = preset.acceleration.y;
+    buffer.age[i] = 0.0f;
+    buffer.lifetime[i] = random(preset.minLifetime, preset.maxLifetime);
+    buffer.effect[i] = effect;
+}
+
+void ParticleSystem::integrateSlice(std::size_t slice, std::size_t sliceCount, float deltaTime) {
+    for (Buffer& buffer : m_buffers) {
+        std::size_t begin = buffer.count * slice / sliceCount;
+        std::size_t end = buffer.count * (slice + 1) / sliceCount;
+        integrate(buffer.x.data(), buffer.y.data(), buffer.vx.data(), buffer.vy.data(),
+            buffer.ax.data(), buffer.ay.data(), buffer.age.data(), begin, end, deltaTime);
+    }
+}
+
+void ParticleSystem::removeExpired(Buffer& buffer) {
+    for (std::size_t i = 0; i < buffer.count;) {
+        if (buffer.age[i] < buffer.lifetime[i]) {
+            ++i;
+            continue;
+        }
+
+        std::size_t last = --buffer.count;
+        buffer.x[i] = buffer.x[last];
+        buffer.y[i] = buffer.y[last];
+        buffer.vx[i] = buffer.vx[last];
+        buffer.vy[i] = buffer.vy[last];
+        buffer.ax[i] = buffer.ax[last];
+        buffer.ay[i] = buffer.ay[last];
+        buffer.age[i] = buffer.age[last];
+        buffer.lifetime[i] = buffer.lifetime[last];
+        buffer.effect[i] = buffer.effect[last];
+    }
+}
+
+void ParticleSystem::workerLoop(std::stop_token stopToken, std::size_t slice, std::uint64_t seenGeneration) {
+    while (true) {
+        float deltaTime = 0.0f;
+        std::latch* done = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_jobMutex);
+            if (!m_jobReady.wait(lock, stopToken, [&] { return m_jobGeneration != seenGeneration; })) {
+                return;
+            }
+            seenGeneration = m_jobGeneration;
+            deltaTime = m_jobDelta;
+            done = m_jobDone;
+        }
+
+        integrateSlice(slice, m_workers.size() + 1, deltaTime);
+        done->count_down();
+    }
+}
+
+const sf::Texture* ParticleSystem::textureFor(Texture texture) const {
+    switch (texture) {
+    case Texture::Dot:  return &m_dotTexture;
+    case Texture::Coin: return m_textures.get(TextureId::Coin);
+    default:            return nullptr;
+    }
+}
+
+float ParticleSystem::random(float min, float max) {
+    return std::uniform_real_distribution<float>(min, max)(m_random);
+}
+
+void ParticleSystem::createDotTexture() {
+    // White disc with a soft edge - effects tint it through the vertex colour
+    sf::Image image;
+    image.create(DOT_TEXTURE_SIZE, DOT_TEXTURE_SIZE, sf::Color::Transparent);
+
+    float center = (DOT_TEXTURE_SIZE - 1) / 2.0f;
+    for (unsigned int y = 0; y < DOT_TEXTURE_SIZE; ++y) {
+        for (unsigned int x = 0; x < DOT_TEXTURE_SIZE; ++x) {
+            float distance = std::hypot(x - center, y - center) / (DOT_TEXTURE_SIZE / 2.0f);
+            float alpha = std::clamp(1.0f - distance, 0.0f, 1.0f);
+            image.setPixel(x, y, sf::Color(255, 255, 255, static_cast<sf::Uint8>(255.0f * std::sqrt(alpha))));
+        }
+    }
+
+    if (!m_dotTexture.loadFromImage(image)) {
+        Logger::log("Failed to create particle texture", LogLevel::Warning);
+    }
+    m_dotTexture.setSmooth(true);
+}
@@ -0,0 +1,163 @@
+#include "PhysicsSystem.h"
+#include "Collision.h"
+#include "Components.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Contacts are reported slightly before surfaces touch, the ball rests SKIN away
+    constexpr float CONTACT_MARGIN = 1.0f;
+
+    float length(sf::Vector2f v) {
+        return std::sqrt(v.x * v.x + v.y * v.y);
+    }
+
+    float dot(sf::Vector2f a, sf::Vector2f b) {
+        return a.x * b.x + a.y * b.y;
+    }
+}
+
+void PhysicsSystem::update(World& world, const TileMap& map, float deltaTime) {
+    syncBroadPhase(world);
+    m_contacts.clear();
+
+    auto& circles = world.pool<CircleCollider>();
+    auto owners = circles.entities();
+    auto values = circles.components();
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        moveBall(world, map, owners[i], values[i].radius, deltaTime);
+    }
+}
+
+void PhysicsSystem::syncBroadPhase(World& world) {
+    auto& positions = world.pool<Position>();
+    auto& boxes = world.pool<BoxCollider>();
+    auto owners = boxes.entities();
+    auto values = boxes.components();
+
+    m_broadPhase.beginUpdate();
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        if (const Position* position = positions.tryGet(owners[i].index)) {
+            m_broadPhase.update(owners[i], sf::FloatRect(position->value - values[i].halfSize, values[i].halfSize * 2.0f));
+        }
+    }
+    m_broadPhase.endUpdate();
+}
+
+void PhysicsSystem::moveBall(World& world, const TileMap& map, Entity ball, float radius, float deltaTime) {
+    Position* position = world.tryGet<Position>(ball);
+    Velocity* velocity = world.tryGet<Velocity>(ball);
+    if (!position || !velocity) {
+        return;
+    }
+
+    Ball* state = world.tryGet<Ball>(ball);
+    bool grounded = false;
+    sf::Vector2f& center = position->value;
+    sf::Vector2f& v = velocity->value;
+    const sf::Vector2f start = center;
+
+    auto landOn = [&](sf::Vector2f normal) {
+        // Drop the velocity into the surface, keep the slide along it
+        float into = dot(v, normal);
+        if (into < 0.0f) {
+            v -= normal * into;
+        }
+        if (normal.y <= GROUND_NORMAL_Y) {
+            grounded = true;
+        }
+    };
+
+    // Resolve any overlap left by spawning or a moving box before sweeping
+    gatherObstacles(world, map, Collision::sweptBounds(center, sf::Vector2f(0.0f, 0.0f), radius));
+    for (const sf::FloatRect& obstacle : m_obstacles) {
+        if (auto push = Collision::penetration(center, radius, obstacle)) {
+            center += *push;
+            landOn(*push / length(*push));
+        }
+    }
+
+    float remaining = deltaTime;
+    for (int sweep = 0; sweep < MAX_SWEEPS && remaining > 0.0f; ++sweep) {
+        sf::Vector2f delta = v * remaining;
+        float distance = length(delta);
+        if (distance < SKIN) {
+            center += delta;
+            break;
+        }
+
+        gatherObstacles(world, map, Collision::sweptBounds(center, delta, radius));
+
+        std::optional<SweepHit> first;
+        for (const sf::FloatRect& obstacle : m_obstacles) {
+            auto hit = Collision::sweepCircle(center, delta, radius, obstacle);
+            if (hit && (!first || hit->time < first->time)) {
+                first = hit;
+            }
+        }
+
+        if (!first) {
+            center += delta;
+            break;
+        }
+
+        // Stop just short of the surface, then slide along it with the time left
+        center += delta * std::max(0.0f, first->time - SKIN / distance);
+        landOn(first->normal);
+        remaining *= 1.0f - first->time;
+    }
+
+    if (state) {
+        state->grounded = grounded;
+    }
+
+    collectContacts(world, ball, start, center, radius);
+}
+
+void PhysicsSystem::gatherObstacles(World& world, const TileMap& map, const sf::FloatRect& area) {
+    m_obstacles.clear();
+
+    sf::Vector2i first = map.toTile(sf::Vector2f(area.left, area.top));
+    sf::Vector2i last = map.toTile(sf::Vector2f(area.left + area.width, area.top + area.height));
+    for (int y = first.y; y <= last.y; ++y) {
+        for (int x = first.x; x <= last.x; ++x) {
+            if (map.isSolid(x, y)) {
+                m_obstacles.push_back(map.getTileBounds(x, y));
+            }
+        }
+    }
+
+    auto& boxes = world.pool<BoxCollider>();
+    auto& positions = world.pool<Position>();
+    m_broadPhase.query(area, m_candidates);
+    for (Entity candidate : m_candidates) {
+        const BoxCollider* box = boxes.tryGet(candidate.index);
+        const Position* position = positions.tryGet(candidate.index);
+        if (box && position && box->solid) {
+            m_obstacles.push_back(sf::FloatRect(position->value - box->halfSize, box->halfSize * 2.0f));
+        }
+    }
+}
+
+void PhysicsSystem::collectContacts(World& world, Entity ball, sf::Vector2f start, sf::Vector2f end, float radius) {
+    auto& boxes = world.pool<BoxCollider>();
+    auto& positions = world.pool<Position>();
+
+    // Everything the ball passed through this tick, not just where it ended up
+    sf::Vector2f delta = end - start;
+    m_broadPhase.query(Collision::sweptBounds(start, delta, radius + CONTACT_MARGIN), m_candidates);
+    for (Entity candidate : m_candidates) {
+        const BoxCollider* box = boxes.tryGet(candidate.index);
+        const Position* position = positions.tryGet(candidate.index);
+        if (!box || !position || candidate == ball) {
+            continue;
+        }
+
+        sf::FloatRect bounds(position->value - box->halfSize, box->halfSize * 2.0f);
+        if (Collision::overlaps(start, radius + CONTACT_MARGIN, bounds) ||
+            Collision::overlaps(end, radius + CONTACT_MARGIN, bounds) ||
+            Collision::sweepCircle(start, delta, radius, bounds)) {
+            m_contacts.push_back(Contact{ ball, candidate });
+        }
+    }
+}
@@ -0,0 +1,119 @@
+#include "SpatialHash.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialHash::SpatialHash(float cellSize)
+    : m_cellSize(cellSize)
+    , m_inverseCellSize(1.0f / cellSize)
+    , m_buckets(BUCKET_COUNT) {
+}
+
+void SpatialHash::beginUpdate() {
+    ++m_updateStamp;
+}
+
+void SpatialHash::update(Entity entity, const sf::FloatRect& bounds) {
+    if (entity.index >= m_proxies.size()) {
+        m_proxies.resize(entity.index + 1);
+    }
+
+    Proxy& proxy = m_proxies[entity.index];
+    CellRange cells = cellsFor(bounds);
+
+    // A recycled index belongs to a new entity - relink it from scratch
+    if (proxy.active && (proxy.entity != entity || proxy.cells != cells)) {
+        unlink(entity.index, proxy.cells);
+        proxy.active = false;
+        --m_proxyCount;
+    }
+
+    if (!proxy.active) {
+        link(entity.index, cells);
+        proxy.active = true;
+        proxy.cells = cells;
+        ++m_proxyCount;
+    }
+
+    proxy.entity = entity;
+    proxy.bounds = bounds;
+    proxy.lastUpdate = m_updateStamp;
+}
+
+void SpatialHash::endUpdate() {
+    for (std::uint32_t index = 0; index < m_proxies.size(); ++index) {
+        Proxy& proxy = m_proxies[index];
+        if (proxy.active && proxy.lastUpdate != m_updateStamp) {
+            unlink(index, proxy.cells);
+            proxy.active = false;
+            --m_proxyCount;
+        }
+    }
+}
+
+void SpatialHash::clear() {
+    for (auto& bucket : m_buckets) {
+        bucket.clear();
+    }
+    m_proxies.clear();
+    m_proxyCount = 0;
+}
+
+void SpatialHash::query(const sf::FloatRect& area, std::vector<Entity>& results) const {
+    results.clear();
+    ++m_queryStamp;
+
+    CellRange range = cellsFor(area);
+    for (int y = range.minY; y <= range.maxY; ++y) {
+        for (int x = range.minX; x <= range.maxX; ++x) {
+            for (std::uint32_t index : m_buckets[bucketFor(x, y)]) {
+                const Proxy& proxy = m_proxies[index];
+                // Large colliders span several cells (and buckets are shared) - report them once
+                if (proxy.lastQuery == m_queryStamp) {
+                    continue;
+                }
+                proxy.lastQuery = m_queryStamp;
+
+                if (proxy.bounds.intersects(area)) {
+                    results.push_back(proxy.entity);
+                }
+            }
+        }
+    }
+}
+
+SpatialHash::CellRange SpatialHash::cellsFor(const sf::FloatRect& bounds) const {
+    return CellRange{
+        static_cast<int>(std::floor(bounds.left * m_inverseCellSize)),
+        static_cast<int>(std::floor(bounds.top * m_inverseCellSize)),
+        static_cast<int>(std::floor((bounds.left + bounds.width) * m_inverseCellSize)),
+        static_cast<int>(std::floor((bounds.top + bounds.height) * m_inverseCellSize)),
+    };
+}
+
+std::size_t SpatialHash::bucketFor(int x, int y) {
+    // Large odd multipliers spread neighbouring cells over the table
+    std::uint32_t hash = static_cast<std::uint32_t>(x) * 73856093u ^ static_cast<std::uint32_t>(y) * 19349663u;
+    return hash & (BUCKET_COUNT - 1);
+}
+
+void SpatialHash::link(std::uint32_t index, const CellRange& cells) {
+    for (int y = cells.minY; y <= cells.maxY; ++y) {
+        for (int x = cells.minX; x <= cells.maxX; ++x) {
+            m_buckets[bucketFor(x, y)].push_back(index);
+        }
+    }
+}
+
+void SpatialHash::unlink(std::uint32_t index, const CellRange& cells) {
+    for (int y = cells.minY; y <= cells.maxY; ++y) {
+        for (int x = cells.minX; x <= cells.maxX; ++x) {
+            // Order inside a bucket does not matter - swap-remove
+            auto& entries = m_buckets[bucketFor(x, y)];
+            auto found = std::find(entries.begin(), entries.end(), index);
+            if (found != entries.end()) {
+                *found = entries.back();
+                entries.pop_back();
+            }
+        }
+    }
+}
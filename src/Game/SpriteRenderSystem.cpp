@@ -0,0 +1,75 @@
+#include "SpriteRenderSystem.h"
+#include "Components.h"
+
+SpriteRenderSystem::SpriteRenderSystem(const GameTextures& textures)
+    : m_textures(textures) {
+    for (auto& batch : m_batches) {
+        batch.setPrimitiveType(sf::Triangles);
+    }
+}
+
+void SpriteRenderSystem::render(World& world, std::span<const Entity> candidates, sf::RenderTarget& target) {
+    for (auto& batch : m_batches) {
+        batch.clear(); // Keeps its capacity
+    }
+
+    const sf::View& view = target.getView();
+    sf::FloatRect visible(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+
+    auto& positions = world.pool<Position>();
+    auto& sprites = world.pool<SpriteComponent>();
+
+    m_lastSpriteCount = 0;
+    for (Entity entity : candidates) {
+        // The index may still list an entity destroyed since it was last synced
+        if (!world.isAlive(entity)) {
+            continue;
+        }
+
+        const SpriteComponent* sprite = sprites.tryGet(entity.index);
+        const Position* position = positions.tryGet(entity.index);
+        const sf::Texture* texture = sprite ? m_textures.get(sprite->texture) : nullptr;
+        if (!position || !texture) {
+            continue;
+        }
+
+        sf::FloatRect bounds(position->value - sprite->size / 2.0f, sprite->size);
+        if (!visible.intersects(bounds)) {
+            continue;
+        }
+
+        appendQuad(m_batches[static_cast<std::size_t>(sprite->texture)], position->value, sprite->size, texture->getSize());
+        ++m_lastSpriteCount;
+    }
+
+    m_lastDrawCalls = 0;
+    for (std::size_t i = 0; i < m_batches.size(); ++i) {
+        if (m_batches[i].getVertexCount() == 0) {
+            continue;
+        }
+
+        sf::RenderStates states;
+        states.texture = m_textures.get(static_cast<TextureId>(i));
+        target.draw(m_batches[i], states);
+        ++m_lastDrawCalls;
+    }
+}
+
+void SpriteRenderSystem::appendQuad(sf::VertexArray& batch, sf::Vector2f center, sf::Vector2f size, sf::Vector2u textureSize,
+    sf::Color color) {
+    sf::Vector2f half = size / 2.0f;
+    float u = static_cast<float>(textureSize.x);
+    float v = static_cast<float>(textureSize.y);
+
+    sf::Vertex topLeft(center + sf::Vector2f(-half.x, -half.y), color, sf::Vector2f(0.0f, 0.0f));
+    sf::Vertex topRight(center + sf::Vector2f(half.x, -half.y), color, sf::Vector2f(u, 0.0f));
+    sf::Vertex bottomRight(center + sf::Vector2f(half.x, half.y), color, sf::Vector2f(u, v));
+    sf::Vertex bottomLeft(center + sf::Vector2f(-half.x, half.y), color, sf::Vector2f(0.0f, v));
+
+    batch.append(topLeft);
+    batch.append(topRight);
+    batch.append(bottomRight);
+    batch.append(topLeft);
+    batch.append(bottomRight);
+    batch.append(bottomLeft);
+}
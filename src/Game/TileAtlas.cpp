@@ -0,0 +1,63 @@
+#include "TileAtlas.h"
+#include "AppContext.h"
+#include "Logger.h"
+#include <algorithm>
+
+namespace {
+    constexpr std::array<const char*, TILE_TYPE_COUNT> FILE_NAMES = {
+        "",
+        "left edge.png",
+        "left.png",
+        "middle.png",
+        "right.png",
+        "right edge.png",
+    };
+}
+
+bool TileAtlas::build() {
+    constexpr unsigned int stride = CELL_SIZE + CELL_PADDING * 2;
+
+    sf::RenderTexture canvas;
+    if (!canvas.create(stride * (TILE_TYPE_COUNT - 1), stride)) {
+        Logger::log("Failed to create tile atlas", LogLevel::Error);
+        return false;
+    }
+    canvas.clear(sf::Color::Transparent);
+
+    auto& textures = AppContext::instance().textures();
+    for (std::size_t i = 1; i < TILE_TYPE_COUNT; ++i) {
+        Piece& piece = m_pieces[i];
+        float cellLeft = static_cast<float>((i - 1) * stride + CELL_PADDING);
+        float cellTop = static_cast<float>(CELL_PADDING);
+
+        try {
+            sf::Texture& source = textures.getResource(FILE_NAMES[i]);
+            source.setSmooth(true);
+            sf::Vector2f sourceSize(source.getSize());
+
+            // Fit the piece to the cell height, keeping its aspect (the edge caps are half-width)
+            float width = std::min(1.0f, sourceSize.x / sourceSize.y);
+            sf::Sprite sprite(source);
+            sprite.setScale(CELL_SIZE * width / sourceSize.x, CELL_SIZE / sourceSize.y);
+            sprite.setPosition(cellLeft, cellTop);
+            canvas.draw(sprite);
+
+            // Edge caps hug the neighbouring tile so the platform has no seam
+            piece.width = width;
+            piece.left = (static_cast<TileType>(i) == TileType::LeftEdge) ? 1.0f - width : 0.0f;
+            piece.textureRect = sf::FloatRect(cellLeft, cellTop, CELL_SIZE * width, static_cast<float>(CELL_SIZE));
+        }
+        catch (const std::exception& e) {
+            Logger::log("Terrain tile missing: " + std::string(e.what()), LogLevel::Warning);
+        }
+    }
+
+    canvas.display();
+    m_texture = canvas.getTexture();
+    m_texture.setSmooth(true);
+    return true;
+}
+
+const char* TileAtlas::fileName(TileType type) {
+    return FILE_NAMES[static_cast<std::size_t>(type)];
+}
@@ -0,0 +1,133 @@
+#include "TileMap.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+bool TileMap::loadFromFile(const std::string& filePath, const TileAtlas& atlas) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file) {
+        Logger::log("Level file not found: " + filePath, LogLevel::Error);
+        return false;
+    }
+
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    if (!parse(contents.str(), atlas)) {
+        Logger::log("Level file is invalid: " + filePath, LogLevel::Error);
+        return false;
+    }
+
+    Logger::log("Loaded level " + filePath + " (" + std::to_string(m_width) + "x" + std::to_string(m_height) +
+        " tiles, " + std::to_string(m_columns.size()) + " columns, " + std::to_string(m_layout->getRunCount()) + " runs)");
+    return true;
+}
+
+bool TileMap::parse(std::string_view text, const TileAtlas& atlas) {
+    auto layout = std::make_shared<LevelLayout>();
+    if (!layout->parse(text)) {
+        return false;
+    }
+
+    m_width = layout->getWidth();
+    m_height = layout->getHeight();
+    m_columns.clear();
+    m_columns.resize(static_cast<std::size_t>(layout->getColumnCount()));
+    m_residentCount = 0;
+    m_layout = std::move(layout);
+    m_atlas = &atlas;
+    return true;
+}
+
+void TileMap::setColumn(std::unique_ptr<TileColumn> column) {
+    if (!column || column->index < 0 || column->index >= getColumnCount()) {
+        return;
+    }
+
+    auto& slot = m_columns[static_cast<std::size_t>(column->index)];
+    if (!slot) {
+        ++m_residentCount;
+    }
+    slot = std::move(column);
+}
+
+std::unique_ptr<TileColumn> TileMap::releaseColumn(int index) {
+    if (index < 0 || index >= getColumnCount()) {
+        return nullptr;
+    }
+
+    auto& slot = m_columns[static_cast<std::size_t>(index)];
+    if (slot) {
+        --m_residentCount;
+    }
+    return std::move(slot);
+}
+
+bool TileMap::isResident(int column) const {
+    return column >= 0 && column < getColumnCount() && m_columns[static_cast<std::size_t>(column)];
+}
+
+int TileMap::columnOf(float x) {
+    return static_cast<int>(std::floor(x / (CHUNK_TILES * TILE_SIZE)));
+}
+
+void TileMap::render(sf::RenderTarget& target) const {
+    m_lastDrawCalls = 0;
+    if (!m_atlas || m_columns.empty()) {
+        return;
+    }
+
+    const sf::View& view = target.getView();
+    sf::FloatRect visible(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+    sf::RenderStates states(&m_atlas->getTexture());
+
+    int first = std::max(columnOf(visible.left), 0);
+    int last = std::min(columnOf(visible.left + visible.width), getColumnCount() - 1);
+    for (int index = first; index <= last; ++index) {
+        const TileColumn* column = m_columns[static_cast<std::size_t>(index)].get();
+        if (!column) {
+            continue;
+        }
+
+        for (const TileChunk& chunk : column->chunks) {
+            if (chunk.vertices.getVertexCount() == 0 || !visible.intersects(chunk.bounds)) {
+                continue;
+            }
+            target.draw(chunk.vertices, states);
+            ++m_lastDrawCalls;
+        }
+    }
+}
+
+TileType TileMap::getTile(int x, int y) const {
+    if (x < 0 || y < 0 || x >= m_width || y >= m_height) {
+        return TileType::Empty;
+    }
+
+    const TileColumn* column = m_columns[static_cast<std::size_t>(x / CHUNK_TILES)].get();
+    if (!column) {
+        return TileType::Empty;
+    }
+    return column->tiles[static_cast<std::size_t>(y) * CHUNK_TILES + x % CHUNK_TILES];
+}
+
+sf::FloatRect TileMap::getTileBounds(int x, int y) const {
+    float left = 0.0f;
+    float width = 1.0f;
+    if (m_atlas) {
+        const TileAtlas::Piece& piece = m_atlas->piece(getTile(x, y));
+        left = piece.left;
+        width = piece.width;
+    }
+    return sf::FloatRect((x + left) * TILE_SIZE, y * TILE_SIZE, width * TILE_SIZE, TILE_SIZE);
+}
+
+sf::Vector2i TileMap::toTile(sf::Vector2f position) const {
+    return sf::Vector2i(static_cast<int>(std::floor(position.x / TILE_SIZE)),
+        static_cast<int>(std::floor(position.y / TILE_SIZE)));
+}
+
+sf::Vector2f TileMap::tileCenter(sf::Vector2i tile) {
+    return sf::Vector2f((tile.x + 0.5f) * TILE_SIZE, (tile.y + 0.5f) * TILE_SIZE);
+}
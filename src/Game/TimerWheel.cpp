@@ -0,0 +1,122 @@
+#include "TimerWheel.h"
+#include <algorithm>
+#include <cmath>
+
+TimerWheel::TimerWheel(std::size_t initialCapacity) {
+    m_slots.fill(NONE);
+    m_timers.reserve(initialCapacity);
+    m_freeTimers.reserve(initialCapacity);
+}
+
+TimerId TimerWheel::schedule(float delaySeconds, std::uint64_t payload) {
+    std::uint32_t index;
+    if (!m_freeTimers.empty()) {
+        index = m_freeTimers.back();
+        m_freeTimers.pop_back();
+    }
+    else {
+        index = static_cast<std::uint32_t>(m_timers.size());
+        m_timers.emplace_back();
+    }
+
+    // Round up so a timer never fires early; the partial tick already elapsed counts towards it
+    float ticks = std::ceil((delaySeconds + m_accumulator) / TICK_SECONDS);
+    Timer& timer = m_timers[index];
+    timer.deadline = m_currentTick + static_cast<std::uint64_t>(std::max(ticks, 1.0f));
+    timer.payload = payload;
+    timer.active = true;
+    link(index);
+
+    ++m_activeCount;
+    return TimerId{ index, timer.generation };
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    if (!isActive(id)) {
+        return false;
+    }
+
+    unlink(id.index);
+    release(id.index);
+    return true;
+}
+
+bool TimerWheel::isActive(TimerId id) const {
+    return id.index < m_timers.size()
+        && m_timers[id.index].active
+        && m_timers[id.index].generation == id.generation;
+}
+
+float TimerWheel::getRemaining(TimerId id) const {
+    if (!isActive(id)) {
+        return 0.0f;
+    }
+    float ticks = static_cast<float>(m_timers[id.index].deadline - m_currentTick);
+    return std::max(0.0f, ticks * TICK_SECONDS - m_accumulator);
+}
+
+void TimerWheel::advance(float deltaTime, std::vector<Expired>& expired) {
+    m_accumulator += deltaTime;
+    while (m_accumulator >= TICK_SECONDS) {
+        m_accumulator -= TICK_SECONDS;
+        ++m_currentTick;
+
+        std::uint32_t index = m_slots[m_currentTick % SLOT_COUNT];
+        while (index != NONE) {
+            Timer& timer = m_timers[index];
+            std::uint32_t next = timer.next;
+
+            // Timers further than one revolution away share the slot - leave them
+            if (timer.deadline <= m_currentTick) {
+                expired.push_back(Expired{ TimerId{ index, timer.generation }, timer.payload });
+                unlink(index);
+                release(index);
+            }
+            index = next;
+        }
+    }
+}
+
+void TimerWheel::clear() {
+    for (std::uint32_t index = 0; index < m_timers.size(); ++index) {
+        if (m_timers[index].active) {
+            unlink(index);
+            release(index);
+        }
+    }
+}
+
+void TimerWheel::link(std::uint32_t index) {
+    Timer& timer = m_timers[index];
+    std::uint32_t& head = m_slots[timer.deadline % SLOT_COUNT];
+
+    timer.previous = NONE;
+    timer.next = head;
+    if (head != NONE) {
+        m_timers[head].previous = index;
+    }
+    head = index;
+}
+
+void TimerWheel::unlink(std::uint32_t index) {
+    Timer& timer = m_timers[index];
+    if (timer.previous != NONE) {
+        m_timers[timer.previous].next = timer.next;
+    }
+    else {
+        m_slots[timer.deadline % SLOT_COUNT] = timer.next;
+    }
+    if (timer.next != NONE) {
+        m_timers[timer.next].previous = timer.previous;
+    }
+    timer.next = NONE;
+    timer.previous = NONE;
+}
+
+void TimerWheel::release(std::uint32_t index) {
+    Timer& timer = m_timers[index];
+    timer.active = false;
+    ++timer.generation;
+    m_freeTimers.push_back(index);
+    --m_activeCount;
+}
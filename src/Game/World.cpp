@@ -0,0 +1,72 @@
+#include "World.h"
+#include <atomic>
+
+std::size_t World::nextComponentTypeId() {
+    static std::atomic<std::size_t> next{ 0 };
+    return next++;
+}
+
+Entity World::create() {
+    std::uint32_t index;
+    if (!m_freeIndices.empty()) {
+        index = m_freeIndices.back();
+        m_freeIndices.pop_back();
+    }
+    else {
+        index = static_cast<std::uint32_t>(m_generations.size());
+        m_generations.push_back(0);
+        m_alive.push_back(false);
+    }
+
+    m_alive[index] = true;
+    ++m_aliveCount;
+    return { index, m_generations[index] };
+}
+
+void World::destroy(Entity entity) {
+    if (!isAlive(entity)) {
+        return;
+    }
+
+    for (auto& pool : m_pools) {
+        if (pool) {
+            pool->removeIndex(entity.index);
+        }
+    }
+
+    m_alive[entity.index] = false;
+    ++m_generations[entity.index];   // Outstanding handles stop resolving
+    m_freeIndices.push_back(entity.index);
+    --m_aliveCount;
+}
+
+void World::destroyLater(Entity entity) {
+    m_pendingDestroy.push_back(entity);
+}
+
+void World::flushDestroyed() {
+    for (Entity entity : m_pendingDestroy) {
+        destroy(entity);   // Duplicates are harmless - the second one no longer resolves
+    }
+    m_pendingDestroy.clear();
+}
+
+void World::clear() {
+    for (auto& pool : m_pools) {
+        if (pool) {
+            pool->clear();
+        }
+    }
+
+    m_freeIndices.clear();
+    for (std::uint32_t index = 0; index < m_generations.size(); ++index) {
+        if (m_alive[index]) {
+            m_alive[index] = false;
+            ++m_generations[index];
+        }
+        m_freeIndices.push_back(index);
+    }
+
+    m_pendingDestroy.clear();
+    m_aliveCount = 0;
+}
@@ -0,0 +1,48 @@
+﻿#include "../../include/Screens/GameOverScreen.h"
+#include "AppContext.h"
+#include "ScreenTypes.h"
+#include "AudioManager.h"
+#include <iostream>
+
+GameOverScreen::GameOverScreen() {
+    try {
+        m_backgroundTexture = AppContext::instance().getTexture("GameOver.png");
+        m_backgroundTexture.setSmooth(true);
+        m_backgroundSprite.setTexture(m_backgroundTexture);
+
+        // Stretch to the virtual canvas - the layout view handles the real window size
+        AppContext::instance().layout().fitToCanvas(m_backgroundSprite);
+    }
+    catch (...) {
+        std::cout << "Error: Could not load GameOver.png!" << std::endl;
+    }
+
+    try {
+        // The table is already sorted in memory - the ranking is ready on the first frame
+        sf::Vector2f center(LayoutManager::VIRTUAL_WIDTH / 2.0f, LayoutManager::VIRTUAL_HEIGHT * 0.62f);
+        m_scoreBoard = std::make_unique<HighScoreBoard>(
+            AppContext::instance().getFont("arial.ttf"), AppContext::instance().highScores(), center);
+    }
+    catch (const std::exception& e) {
+        std::cout << "Error: Could not build the high score board: " << e.what() << std::endl;
+    }
+
+    AudioManager::instance().playSound("game_over");
+}
+
+void GameOverScreen::registerInputHandlers(InputEventBus& bus) {
+    auto backToMenu = [] {
+        AppContext::instance().screenManager().changeScreen(ScreenType::MENU);
+    };
+    bus.subscribeKey(sf::Keyboard::Escape, backToMenu);
+    bus.subscribeKey(sf::Keyboard::Enter, backToMenu);
+}
+
+void GameOverScreen::update(float deltaTime) {}
+
+void GameOverScreen::render(sf::RenderWindow& window) {
+    window.draw(m_backgroundSprite);
+    if (m_scoreBoard) {
+        m_scoreBoard->render(window);
+    }
+}
@@ -2,19 +2,18 @@
 #include "ScreenTypes.h"
 #include "../../include/Screens/LoadingScreen.h"
 #include "../Core/AudioManager.h"
+#include <algorithm>
 
 LoadingScreen::LoadingScreen() {
+    auto& layout = AppContext::instance().layout();
+
     try {
         m_backgroundTexture = AppContext::instance().getTexture("LoadingScreen.png");
+        m_backgroundTexture.setSmooth(true);
         m_backgroundSprite.setTexture(m_backgroundTexture);
 
-        sf::Vector2u textureSize = m_backgroundTexture.getSize();
-        sf::Vector2f targetSize(1400.0f, 800.0f); // Window size
-
-        float scaleX = targetSize.x / textureSize.x;
-        float scaleY = targetSize.y / textureSize.y;
-        m_backgroundSprite.setScale(scaleX, scaleY);
-
+        // Stretch to the virtual canvas - the layout view handles the real window size
+        layout.fitToCanvas(m_backgroundSprite);
     }
     catch (...) {
         // If image fails to load, create a simple colored background
@@ -28,22 +27,36 @@ LoadingScreen::LoadingScreen() {
         }
         m_backgroundTexture.update(pixels);
         m_backgroundSprite.setTexture(m_backgroundTexture);
+        layout.fitToCanvas(m_backgroundSprite);
         delete[] pixels;
     }
-    AudioManager::instance().playMusic("loading_music", true);
+
+    setupProgressBar();
 }
 
-void LoadingScreen::handleEvents(sf::RenderWindow& window) {
-    sf::Event event;
-    while (window.pollEvent(event)) {
-        if (event.type == sf::Event::Closed) {
-            window.close();
-        }
-    }
+void LoadingScreen::setupProgressBar() {
+    // Anchored once to the bottom-center of the virtual canvas
+    sf::FloatRect barRect = AppContext::instance().layout().anchoredRect(
+        Anchor::Bottom, sf::Vector2f(0.0f, -PROGRESS_BAR_MARGIN), PROGRESS_BAR_SIZE);
+
+    m_progressBar.setPosition(barRect.left, barRect.top);
+    m_progressBar.setSize(sf::Vector2f(0.0f, barRect.height));
+    m_progressBar.setFillColor(sf::Color(245, 245, 220));
+
+    m_progressFrame.setPosition(barRect.left, barRect.top);
+    m_progressFrame.setSize(PROGRESS_BAR_SIZE);
+    m_progressFrame.setFillColor(sf::Color::Transparent);
+    m_progressFrame.setOutlineThickness(2);
+    m_progressFrame.setOutlineColor(sf::Color::White);
+}
+
+void LoadingScreen::registerInputHandlers(InputEventBus& /*bus*/) {
+    // No interaction while loading - window close is handled by the game loop
 }
 
 void LoadingScreen::update(float deltaTime) {
     m_progress += deltaTime * 0.5f; // Loading speed
+    m_progressBar.setSize(sf::Vector2f(PROGRESS_BAR_SIZE.x * std::min(m_progress, 1.0f), PROGRESS_BAR_SIZE.y));
 
     if (m_progress >= 1.0f && !m_finished) {
         m_finished = true;
@@ -58,17 +71,7 @@ void LoadingScreen::render(sf::RenderWindow& window) {
     // Draw loading text
     window.draw(m_loadingText);
 
-    // Progress bar
-    sf::RectangleShape progressBar(sf::Vector2f(400 * m_progress, 20));
-    progressBar.setPosition(500, 700);
-    progressBar.setFillColor(sf::Color(245, 245, 220));
-    window.draw(progressBar);
-
-    // Progress bar frame
-    sf::RectangleShape progressFrame(sf::Vector2f(400, 20));
-    progressFrame.setPosition(500, 700);
-    progressFrame.setFillColor(sf::Color::Transparent);
-    progressFrame.setOutlineThickness(2);
-    progressFrame.setOutlineColor(sf::Color::White);
-    window.draw(progressFrame);
+    // Progress bar and its frame
+    window.draw(m_progressBar);
+    window.draw(m_progressFrame);
 }
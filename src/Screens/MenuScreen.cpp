@@ -4,28 +4,30 @@
 #include "../UI/ObservableButton.h"
 #include "../UI/MenuButtonObserver.h"
 #include "AudioManager.h"
+#include <algorithm>
 
 MenuScreen::MenuScreen() {
+    auto& layout = AppContext::instance().layout();
+
     // Load background image or create fallback gradient
     try {
         m_backgroundTexture = AppContext::instance().getTexture("MenuScreen.png");
+        m_backgroundTexture.setSmooth(true);
         m_backgroundSprite.setTexture(m_backgroundTexture);
 
-        // Scale to fit 1600x900 window
-        sf::Vector2u textureSize = m_backgroundTexture.getSize();
-        sf::Vector2f targetSize(1600.0f, 900.0f);
-        float scaleX = targetSize.x / textureSize.x;
-        float scaleY = targetSize.y / textureSize.y;
-        m_backgroundSprite.setScale(scaleX, scaleY);
+        // Stretch to the virtual canvas - the layout view handles the real window size
+        layout.fitToCanvas(m_backgroundSprite);
     }
     catch (...) {
-        // Fallback: create gradient background
-        m_backgroundTexture.create(1600, 900);
-        sf::Uint8* pixels = new sf::Uint8[1600 * 900 * 4];
-        for (int y = 0; y < 900; y++) {
-            for (int x = 0; x < 1600; x++) {
-                int index = (y * 1600 + x) * 4;
-                float gradient = (float)y / 900.0f;
+        // Fallback: create gradient background at the virtual resolution
+        const int width = static_cast<int>(LayoutManager::VIRTUAL_WIDTH);
+        const int height = static_cast<int>(LayoutManager::VIRTUAL_HEIGHT);
+        m_backgroundTexture.create(width, height);
+        sf::Uint8* pixels = new sf::Uint8[width * height * 4];
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                int index = (y * width + x) * 4;
+                float gradient = (float)y / (float)height;
                 pixels[index] = (sf::Uint8)(50 + 100 * gradient);     // R
                 pixels[index + 1] = (sf::Uint8)(30 + 80 * gradient);  // G
                 pixels[index + 2] = (sf::Uint8)(80 + 120 * gradient); // B
@@ -36,32 +38,42 @@ MenuScreen::MenuScreen() {
         m_backgroundSprite.setTexture(m_backgroundTexture);
         delete[] pixels;
     }
+
+    // Title shadow is baked with the glyphs and drawn in one pass
+    m_titleEffect.setShadow(sf::Color(0, 0, 0, 100), sf::Vector2f(5.0f, 5.0f));
+    m_titleEffect.setText(m_titleText);
+
     setupButtons();
 }
 
 void MenuScreen::setupButtons() {
+    auto& layout = AppContext::instance().layout();
+
     // Create observer for button events
     m_buttonObserver = std::make_shared<MenuButtonObserver>();
 
-    // Button layout configuration
-    const float buttonWidth = 300.0f;
-    const float buttonHeight = 100.0f;
+    // Button layout configuration (virtual coordinates)
+    const sf::Vector2f buttonSize(300.0f, 100.0f);
     const float buttonSpacing = 150.0f;
     const float startY = 200.0f;
-    const float centerX = (1400.0f - buttonWidth - 120.0f);
+    const float rightMargin = 120.0f;
+
+    const sf::Vector2f aboutButtonSize(130.0f, 100.0f);
+    const sf::Vector2f aboutButtonOffset(30.0f, -50.0f);
 
-    const float aboutButtonWidth = 130.0f;
-    const float aboutButtonHeight = 100.0f;
-    const float aboutButtonX = 30.0f;
-    const float aboutButtonY = 650.0f;
+    // Main column is anchored to the right edge, About Us to the bottom-left corner
+    auto columnPosition = [&](int row) {
+        return layout.anchor(Anchor::TopRight,
+            sf::Vector2f(-rightMargin, startY + static_cast<float>(row) * buttonSpacing), buttonSize);
+    };
 
     // Clear existing buttons
     m_observableButtons.clear();
 
     // About Us button
     auto aboutBtn = ButtonFactory::createAboutButton(
-        sf::Vector2f(aboutButtonX, aboutButtonY),
-        sf::Vector2f(aboutButtonWidth, aboutButtonHeight),
+        layout.anchor(Anchor::BottomLeft, aboutButtonOffset, aboutButtonSize),
+        aboutButtonSize,
         m_buttonObserver,
         m_font
     );
@@ -69,8 +81,8 @@ void MenuScreen::setupButtons() {
 
     // Start Game button
     auto startBtn = ButtonFactory::createStartButton(
-        sf::Vector2f(centerX, startY),
-        sf::Vector2f(buttonWidth, buttonHeight),
+        columnPosition(0),
+        buttonSize,
         m_buttonObserver,
         m_font
     );
@@ -78,8 +90,8 @@ void MenuScreen::setupButtons() {
 
     // Settings button
     auto settingsBtn = ButtonFactory::createSettingsButton(
-        sf::Vector2f(centerX, startY + buttonSpacing),
-        sf::Vector2f(buttonWidth, buttonHeight),
+        columnPosition(1),
+        buttonSize,
         m_buttonObserver,
         m_font
     );
@@ -87,8 +99,8 @@ void MenuScreen::setupButtons() {
 
     // Help button
     auto helpBtn = ButtonFactory::createHelpButton(
-        sf::Vector2f(centerX, startY + 2 * buttonSpacing),
-        sf::Vector2f(buttonWidth, buttonHeight),
+        columnPosition(2),
+        buttonSize,
         m_buttonObserver,
         m_font
     );
@@ -96,48 +108,66 @@ void MenuScreen::setupButtons() {
 
     // Exit button
     auto exitBtn = ButtonFactory::createExitButton(
-        sf::Vector2f(centerX, startY + 3 * buttonSpacing),
-        sf::Vector2f(buttonWidth, buttonHeight),
+        columnPosition(3),
+        buttonSize,
         m_buttonObserver,
         m_font
     );
     m_observableButtons.push_back(std::move(exitBtn));
+
+    rebuildHitGrid();
 }
 
-void MenuScreen::handleEvents(sf::RenderWindow& window) {
-    sf::Event event;
-    while (window.pollEvent(event)) {
-        if (event.type == sf::Event::Closed) {
-            window.close();
-        }
+void MenuScreen::rebuildHitGrid() {
+    m_hitGrid.clear();
+    m_hoveredButtons.clear();
 
-        if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape) {
-            window.close();
-        }
+    for (const auto& button : m_observableButtons) {
+        m_hitGrid.insert(button->getBounds());
+    }
+}
 
-        // Observer Pattern in action - handle button interactions
-        if (event.type == sf::Event::MouseMoved) {
-            sf::Vector2f mousePos(static_cast<float>(event.mouseMove.x),
-                static_cast<float>(event.mouseMove.y));
+void MenuScreen::registerInputHandlers(InputEventBus& bus) {
+    bus.subscribeKey(sf::Keyboard::Escape, [] {
+        AppContext::instance().screenManager().requestQuit();
+    });
 
-            for (auto& button : m_observableButtons) {
-                button->handleMouseMove(mousePos);  // Sends hover notifications
-            }
+    // Moves arrive already coalesced and in virtual coordinates
+    bus.subscribe(sf::Event::MouseMoved, [this](const InputEvent& input) {
+        routeMouseMove(input.position);
+        return true;
+    });
+
+    bus.subscribe(sf::Event::MouseButtonPressed, [this](const InputEvent& input) {
+        return input.event.mouseButton.button == sf::Mouse::Left && dispatchClick(input.position);
+    });
+}
+
+void MenuScreen::routeMouseMove(const sf::Vector2f& mousePos) {
+    const auto& hits = m_hitGrid.query(mousePos);
+
+    // Buttons the mouse just left still need the move to clear their hover state
+    for (auto id : m_hoveredButtons) {
+        if (std::find(hits.begin(), hits.end(), id) == hits.end()) {
+            m_observableButtons[id]->handleMouseMove(mousePos);
         }
+    }
 
-        if (event.type == sf::Event::MouseButtonPressed) {
-            if (event.mouseButton.button == sf::Mouse::Left) {
-                sf::Vector2f mousePos(static_cast<float>(event.mouseButton.x),
-                    static_cast<float>(event.mouseButton.y));
+    // Observer Pattern in action - only buttons under the mouse get hover notifications
+    for (auto id : hits) {
+        m_observableButtons[id]->handleMouseMove(mousePos);
+    }
 
-                for (auto& button : m_observableButtons) {
-                    if (button->handleClick(mousePos)) {  // Sends click notifications
-                        break; // Stop after first button clicked
-                    }
-                }
-            }
+    m_hoveredButtons.assign(hits.begin(), hits.end());
+}
+
+bool MenuScreen::dispatchClick(const sf::Vector2f& mousePos) {
+    for (auto id : m_hitGrid.query(mousePos)) {
+        if (m_observableButtons[id]->handleClick(mousePos)) {  // Sends click notifications
+            return true; // Stop after first button clicked
         }
     }
+    return false;
 }
 
 void MenuScreen::update(float deltaTime) {
@@ -148,6 +178,7 @@ void MenuScreen::update(float deltaTime) {
     sf::Color titleColor = sf::Color::Yellow;
     titleColor.a = (sf::Uint8)(255 * glowIntensity);
     m_titleText.setFillColor(titleColor);
+    m_titleEffect.setFillColor(titleColor);
 
     // Update all observable buttons
     for (auto& button : m_observableButtons) {
@@ -160,11 +191,7 @@ void MenuScreen::render(sf::RenderWindow& window) {
     window.draw(m_backgroundSprite);
 
     // Draw title with shadow effect
-    sf::Text titleShadow = m_titleText;
-    titleShadow.setFillColor(sf::Color(0, 0, 0, 100));
-    titleShadow.setPosition(m_titleText.getPosition().x + 5, m_titleText.getPosition().y + 5);
-    window.draw(titleShadow);
-    window.draw(m_titleText);
+    m_titleEffect.render(window);
 
     // Draw all observable buttons
     for (auto& button : m_observableButtons) {
@@ -0,0 +1,479 @@
+﻿#include "../../include/Screens/PlayScreen.h"
+#include "AppContext.h"
+#include "AudioManager.h"
+#include "ScreenTypes.h"
+#include "Logger.h"
+#include <algorithm>
+#include <optional>
+
+namespace {
+    struct SpawnType {
+        char code;
+        EntityKind kind;
+        TextureId texture;
+        sf::Vector2f size;
+        GiftType gift = GiftType::Speed;
+    };
+
+    // Level file object codes - see resources/levels/level1.lvl
+    const SpawnType SPAWN_TYPES[] = {
+        { 'c', EntityKind::Coin,        TextureId::Coin,                 { 32.0f, 32.0f } },
+        { 'r', EntityKind::RareCoin,    TextureId::RareCoin,             { 40.0f, 40.0f } },
+        { 'x', EntityKind::Cactus,      TextureId::Cactus,               { 48.0f, 64.0f } },
+        { 'b', EntityKind::Box,         TextureId::ClosedBox,            { 56.0f, 56.0f } },
+        { 'f', EntityKind::FalconEnemy, TextureId::FalconEnemy,          { 72.0f, 56.0f } },
+        { 's', EntityKind::SquareEnemy, TextureId::SquareEnemy,          { 56.0f, 56.0f } },
+        { 'S', EntityKind::Gift,        TextureId::SpeedGift,            { 40.0f, 40.0f }, GiftType::Speed },
+        { 'R', EntityKind::Gift,        TextureId::ReverseMovementGift,  { 40.0f, 40.0f }, GiftType::ReverseMovement },
+        { 'H', EntityKind::Gift,        TextureId::HeadwindStormGift,    { 40.0f, 40.0f }, GiftType::HeadwindStorm },
+        { 'L', EntityKind::Gift,        TextureId::LifeHeartGift,        { 40.0f, 40.0f }, GiftType::LifeHeart },
+        { 'D', EntityKind::Gift,        TextureId::ProtectiveShieldGift, { 40.0f, 40.0f }, GiftType::ProtectiveShield },
+    };
+
+    const sf::Vector2f BALL_SIZE(48.0f, 48.0f);
+
+    // Objects sit on the bottom of their cell
+    sf::Vector2f groundedCenter(sf::Vector2i tile, sf::Vector2f size) {
+        return sf::Vector2f((tile.x + 0.5f) * TileMap::TILE_SIZE, (tile.y + 1.0f) * TileMap::TILE_SIZE - size.y / 2.0f);
+    }
+}
+
+PlayScreen::PlayScreen()
+    : m_spriteRenderer(m_textures)
+    , m_effects(m_textures)
+    , m_particles(m_textures)
+    , m_frameArena(FRAME_ARENA_BYTES)
+    , m_streamer(m_tileMap, m_tileAtlas) {
+    m_textures.load();
+    m_tileAtlas.build();
+    m_tileMap.loadFromFile(LEVEL_FILE, m_tileAtlas);
+
+    m_background.setTexture(m_textures.get(TextureId::Background));
+    m_falconSound = AudioManager::instance().getSoundId("falcon");
+
+    spawnBall();
+
+    m_camera.setViewSize(AppContext::instance().layout().getVirtualSize());
+    m_camera.setBounds(sf::FloatRect(sf::Vector2f(0.0f, 0.0f), m_tileMap.getPixelSize()));
+    m_camera.snapTo(m_ballStart);
+
+    // The start area is built right away, the rest streams in around the camera
+    m_streamer.prime(m_camera.getVisibleArea());
+    for (const LevelSpawn& levelSpawn : m_streamer.getArrivedSpawns()) {
+        spawnObject(levelSpawn);
+    }
+
+    m_particles.setWorkerCount(ParticleSystem::defaultWorkerCount());
+    m_dustEmitter = m_particles.addEmitter(ParticleEffect::Dust, m_camera.getVisibleArea());
+
+    Logger::log("Play screen ready with " + std::to_string(m_world.getAliveCount()) + " entities");
+}
+
+void PlayScreen::registerInputHandlers(InputEventBus& bus) {
+    bus.subscribeKey(sf::Keyboard::Escape, [] {
+        AppContext::instance().screenManager().changeScreen(ScreenType::MENU);
+    });
+
+    // Held keys drive the ball continuously - track press/release instead of one-shot actions
+    auto setKey = [this](sf::Keyboard::Key key, bool pressed) {
+        switch (key) {
+        case sf::Keyboard::Left:
+        case sf::Keyboard::A:
+            m_leftHeld = pressed;
+            return true;
+        case sf::Keyboard::Right:
+        case sf::Keyboard::D:
+            m_rightHeld = pressed;
+            return true;
+        case sf::Keyboard::Up:
+        case sf::Keyboard::W:
+        case sf::Keyboard::Space:
+            if (pressed) m_input.jumpRequested = true;
+            return true;
+        default:
+            return false;
+        }
+    };
+
+    bus.subscribe(sf::Event::KeyPressed, [setKey](const InputEvent& input) {
+        return setKey(input.event.key.code, true);
+    });
+    bus.subscribe(sf::Event::KeyReleased, [setKey](const InputEvent& input) {
+        return setKey(input.event.key.code, false);
+    });
+}
+
+void PlayScreen::update(float deltaTime) {
+    m_frameArena.reset();
+    m_input.moveAxis = (m_rightHeld ? 1.0f : 0.0f) - (m_leftHeld ? 1.0f : 0.0f);
+
+    m_gifts.update(m_world, deltaTime);
+    m_ballController.update(m_world, m_ball, m_input, deltaTime);
+    m_movement.update(m_world, deltaTime);
+    m_magnets.update(m_world, m_physics.getBroadPhase(), m_frameArena, deltaTime);
+    m_enemies.update(m_world, m_tileMap, m_camera.getVisibleArea(), m_ball, deltaTime);
+    m_physics.update(m_world, m_tileMap, deltaTime);
+    handleContacts();
+    checkFallOut();
+    updateFalconSounds();
+    m_effects.update(deltaTime);
+
+    followBall(deltaTime);
+    streamLevel();
+    m_particles.setEmitterArea(m_dustEmitter, m_camera.getVisibleArea());
+    updateStorm();
+    m_particles.update(deltaTime);
+
+    m_input.jumpRequested = false;
+    m_world.flushDestroyed();
+}
+
+void PlayScreen::render(sf::RenderWindow& window) {
+    // Background is drawn on the canvas, the level scrolls under the camera view
+    m_background.render(window, AppContext::instance().layout().getVirtualSize(), m_camera.getCenter().x);
+
+    // Keep the layout viewport current (the window may have been resized)
+    const sf::View canvasView = window.getView();
+    sf::View worldView = m_camera.getView();
+    worldView.setViewport(canvasView.getViewport());
+    window.setView(worldView);
+
+    m_visible.clear();
+    m_camera.collectVisible(m_world, m_physics.getBroadPhase(), m_visible);
+
+    m_tileMap.render(window);
+    m_spriteRenderer.render(m_world, m_visible, window);
+    m_effects.render(window);
+    m_particles.render(window);
+    window.setView(canvasView);
+}
+
+Entity PlayScreen::spawn(EntityKind kind, TextureId texture, sf::Vector2f position, sf::Vector2f size) {
+    Entity entity = m_world.create();
+    m_world.add(entity, Position{ position });
+    m_world.add(entity, SpriteComponent{ texture, size });
+    m_world.add(entity, Kind{ kind });
+    return entity;
+}
+
+void PlayScreen::spawnBall() {
+    auto layout = m_tileMap.getLayout();
+    std::optional<sf::Vector2i> startTile = layout ? layout->getBallStart() : std::nullopt;
+    m_ballStart = groundedCenter(startTile.value_or(sf::Vector2i(1, 0)), BALL_SIZE);
+
+    m_ball = spawn(EntityKind::Ball, TextureId::NormalBall, m_ballStart, BALL_SIZE);
+    m_world.add(m_ball, Velocity{});
+    m_world.add(m_ball, Ball{});
+    m_world.add(m_ball, Modifiers{});
+    m_world.add(m_ball, CircleCollider{ BALL_SIZE.x / 2.0f });
+}
+
+void PlayScreen::spawnObject(const LevelSpawn& levelSpawn) {
+    SpawnState state = m_streamer.getSpawnState(levelSpawn.id);
+    if (state == SpawnState::Consumed) {
+        return;
+    }
+
+    const SpawnType* type = nullptr;
+    for (const SpawnType& candidate : SPAWN_TYPES) {
+        if (candidate.code == levelSpawn.code) {
+            type = &candidate;
+            break;
+        }
+    }
+    if (!type) {
+        Logger::log(std::string("Unknown level object '") + levelSpawn.code + "' skipped", LogLevel::Warning);
+        return;
+    }
+
+    Entity entity = spawn(type->kind, type->texture, groundedCenter(levelSpawn.tile, type->size), type->size);
+    m_world.add(entity, BoxCollider{ type->size / 2.0f, type->kind == EntityKind::Box });
+    m_world.add(entity, LevelObject{ levelSpawn.id, levelSpawn.tile.x / TileMap::CHUNK_TILES });
+    if (type->kind == EntityKind::Coin || type->kind == EntityKind::RareCoin) {
+        m_world.add(entity, CoinValue{ type->kind == EntityKind::RareCoin ? 5 : 1 });
+    }
+    if (type->kind == EntityKind::Gift) {
+        m_world.add(entity, Gift{ type->gift });
+    }
+    if (type->kind == EntityKind::FalconEnemy || type->kind == EntityKind::SquareEnemy) {
+        m_enemies.add(m_world, entity);
+    }
+    if (type->kind == EntityKind::Box && state == SpawnState::Opened) {
+        m_world.add(entity, Opened{});
+        m_world.tryGet<SpriteComponent>(entity)->texture = TextureId::OpenBox;
+    }
+}
+
+void PlayScreen::despawnColumn(int column) {
+    // Still alive means not collected - it comes back when the column does
+    auto& objects = m_world.pool<LevelObject>();
+    auto owners = objects.entities();
+    auto values = objects.components();
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        if (values[i].column == column) {
+            m_world.destroyLater(owners[i]);
+        }
+    }
+}
+
+void PlayScreen::streamLevel() {
+    m_streamer.update(m_camera.getVisibleArea());
+    for (int column : m_streamer.getDroppedColumns()) {
+        despawnColumn(column);
+    }
+    for (const LevelSpawn& levelSpawn : m_streamer.getArrivedSpawns()) {
+        spawnObject(levelSpawn);
+    }
+}
+
+void PlayScreen::markSpawn(Entity entity, SpawnState state) {
+    if (const LevelObject* object = m_world.tryGet<LevelObject>(entity)) {
+        m_streamer.setSpawnState(object->spawnId, state);
+    }
+}
+
+void PlayScreen::handleContacts() {
+    Ball* ball = m_world.tryGet<Ball>(m_ball);
+    if (!ball) {
+        return;
+    }
+
+    for (const Contact& contact : m_physics.getContacts()) {
+        const Kind* kind = m_world.tryGet<Kind>(contact.other);
+        if (!kind) {
+            continue;
+        }
+
+        switch (kind->value) {
+        case EntityKind::Coin:
+        case EntityKind::RareCoin:
+            if (const CoinValue* coin = m_world.tryGet<CoinValue>(contact.other)) {
+                ball->score += coin->value;
+            }
+            if (const Position* position = m_world.tryGet<Position>(contact.other)) {
+                const SpriteComponent* sprite = m_world.tryGet<SpriteComponent>(contact.other);
+                m_effects.spawn(EffectType::CoinPickup,
+                    kind->value == EntityKind::RareCoin ? TextureId::RareCoin : TextureId::Coin,
+                    position->value, sprite ? sprite->size : sf::Vector2f(32.0f, 32.0f));
+                m_particles.burst(ParticleEffect::CoinSparkle, position->value);
+                if (kind->value == EntityKind::RareCoin) {
+                    m_particles.burst(ParticleEffect::CoinBurst, position->value);
+                }
+            }
+            markSpawn(contact.other, SpawnState::Consumed);
+            m_world.destroyLater(contact.other);
+            AudioManager::instance().playSound("coin");
+            break;
+        case EntityKind::Box:
+            openBox(contact.other);
+            break;
+        case EntityKind::Gift:
+            collectGift(contact.other);
+            break;
+        case EntityKind::FalconEnemy:
+        case EntityKind::SquareEnemy:
+            hitEnemy(contact.other);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void PlayScreen::openBox(Entity box) {
+    if (m_world.has<Opened>(box)) {
+        return;
+    }
+
+    m_world.add(box, Opened{});
+    markSpawn(box, SpawnState::Opened);
+    if (SpriteComponent* sprite = m_world.tryGet<SpriteComponent>(box)) {
+        sprite->texture = TextureId::OpenBox;
+    }
+    AudioManager::instance().playSound("open_box");
+    m_gifts.addModifier(m_world, m_ball, ModifierType::Magnetic, MAGNET_DURATION);
+
+    if (const Position* position = m_world.tryGet<Position>(box)) {
+        m_effects.spawn(EffectType::BoxOpened, TextureId::MagneticBall, position->value, BALL_SIZE);
+    }
+}
+
+void PlayScreen::collectGift(Entity gift) {
+    const Gift* type = m_world.tryGet<Gift>(gift);
+    if (!type) {
+        return;
+    }
+
+    m_gifts.collect(m_world, m_ball, type->type);
+    if (const Position* position = m_world.tryGet<Position>(gift)) {
+        const SpriteComponent* sprite = m_world.tryGet<SpriteComponent>(gift);
+        if (sprite) {
+            m_effects.spawn(EffectType::CoinPickup, sprite->texture, position->value, sprite->size);
+        }
+        m_particles.burst(ParticleEffect::CoinSparkle, position->value);
+    }
+
+    // Only remove the gift component so a second contact this frame cannot collect it again
+    m_world.remove<Gift>(gift);
+    markSpawn(gift, SpawnState::Consumed);
+    m_world.destroyLater(gift);
+    AudioManager::instance().playSound("open_box");
+}
+
+void PlayScreen::updateStorm() {
+    const Modifiers* modifiers = m_world.tryGet<Modifiers>(m_ball);
+    bool stormy = modifiers && modifiers->stacksOf(ModifierType::Headwind) > 0;
+    sf::FloatRect area = m_camera.getVisibleArea();
+
+    if (stormy && m_stormEmitter == NO_EMITTER) {
+        m_stormEmitter = m_particles.addEmitter(ParticleEffect::Sandstorm, area);
+    }
+    else if (!stormy && m_stormEmitter != NO_EMITTER) {
+        m_particles.removeEmitter(m_stormEmitter);
+        m_stormEmitter = NO_EMITTER;
+    }
+    else if (stormy) {
+        m_particles.setEmitterArea(m_stormEmitter, area);
+    }
+}
+
+void PlayScreen::hitEnemy(Entity enemy) {
+    // Already killed by an earlier contact this frame
+    if (!m_world.has<EnemyAI>(enemy)) {
+        return;
+    }
+
+    const Modifiers* modifiers = m_world.tryGet<Modifiers>(m_ball);
+    if (modifiers && modifiers->stacksOf(ModifierType::Shield) > 0) {
+        killEnemy(enemy);
+        return;
+    }
+
+    // Landing on top of an enemy kills it and bounces the ball
+    Position* ballPosition = m_world.tryGet<Position>(m_ball);
+    Velocity* ballVelocity = m_world.tryGet<Velocity>(m_ball);
+    const Position* enemyPosition = m_world.tryGet<Position>(enemy);
+    if (ballPosition && ballVelocity && enemyPosition && ballVelocity->value.y > 0.0f
+        && ballPosition->value.y < enemyPosition->value.y) {
+        ballVelocity->value.y = -STOMP_BOUNCE;
+        killEnemy(enemy);
+        return;
+    }
+
+    loseLife();
+}
+
+void PlayScreen::killEnemy(Entity enemy) {
+    if (Ball* ball = m_world.tryGet<Ball>(m_ball)) {
+        ball->score += ENEMY_SCORE;
+    }
+
+    if (const Position* position = m_world.tryGet<Position>(enemy)) {
+        if (const SpriteComponent* sprite = m_world.tryGet<SpriteComponent>(enemy)) {
+            m_effects.spawn(EffectType::EnemyKilled, sprite->texture, position->value, sprite->size);
+        }
+        m_particles.burst(ParticleEffect::Explosion, position->value);
+    }
+
+    // The AI drops it from its schedule once the component is gone
+    m_world.remove<EnemyAI>(enemy);
+    markSpawn(enemy, SpawnState::Consumed);
+    m_world.destroyLater(enemy);
+    AudioManager::instance().playSound("kill_enemy");
+}
+
+void PlayScreen::loseLife() {
+    Ball* ball = m_world.tryGet<Ball>(m_ball);
+    Position* position = m_world.tryGet<Position>(m_ball);
+    Velocity* velocity = m_world.tryGet<Velocity>(m_ball);
+    if (!ball || !position || !velocity) {
+        return;
+    }
+
+    --ball->lives;
+    if (ball->lives <= 0) {
+        endGame(ScreenType::GAMEOVER);
+        return;
+    }
+
+    AudioManager::instance().playSound("lost_life");
+    position->value = m_ballStart;
+    velocity->value = sf::Vector2f(0.0f, 0.0f);
+    m_camera.snapTo(m_ballStart);
+}
+
+void PlayScreen::endGame(ScreenType result) {
+    // Two contacts in the same frame can both end the game - submit once
+    if (m_gameOver) {
+        return;
+    }
+    m_gameOver = true;
+
+    if (const Ball* ball = m_world.tryGet<Ball>(m_ball)) {
+        auto rank = AppContext::instance().highScores().submit(PLAYER_NAME, ball->score);
+        Logger::log("Game ended with score " + std::to_string(ball->score) +
+            (rank ? ", rank " + std::to_string(*rank) : std::string()));
+    }
+    AppContext::instance().screenManager().changeScreen(result);
+}
+
+void PlayScreen::checkFallOut() {
+    Position* position = m_world.tryGet<Position>(m_ball);
+    Velocity* velocity = m_world.tryGet<Velocity>(m_ball);
+    if (!position || !velocity) {
+        return;
+    }
+
+    // Fell into a pit
+    if (position->value.y - BALL_SIZE.y > m_tileMap.getPixelSize().y) {
+        loseLife();
+        return;
+    }
+
+    // Reaching the right end finishes the level, the left end is a wall
+    float half = BALL_SIZE.x / 2.0f;
+    float levelWidth = std::max(m_tileMap.getPixelSize().x, BALL_SIZE.x);
+    if (position->value.x >= levelWidth - half) {
+        endGame(ScreenType::WINNING);
+    }
+    if (position->value.x < half || position->value.x > levelWidth - half) {
+        position->value.x = std::clamp(position->value.x, half, levelWidth - half);
+        velocity->value.x = 0.0f;
+    }
+}
+
+void PlayScreen::followBall(float deltaTime) {
+    const Position* position = m_world.tryGet<Position>(m_ball);
+    const Velocity* velocity = m_world.tryGet<Velocity>(m_ball);
+    if (position && velocity) {
+        m_camera.follow(position->value, velocity->value, deltaTime);
+    }
+
+    // Positional sounds are heard from the middle of the screen
+    AudioManager::instance().setListenerPosition(m_camera.getCenter());
+}
+
+void PlayScreen::updateFalconSounds() {
+    auto& audio = AudioManager::instance();
+    for (Entity falcon : m_enemies.getSwoopsStarted()) {
+        if (const Position* position = m_world.tryGet<Position>(falcon)) {
+            VoiceHandle voice = audio.playSoundAt(m_falconSound, position->value);
+            if (voice.isValid()) {
+                m_falconVoices.push_back(TrackedVoice{ falcon, voice });
+            }
+        }
+    }
+
+    // A killed falcon leaves its sound where it died
+    for (std::size_t i = 0; i < m_falconVoices.size();) {
+        const Position* position = m_world.tryGet<Position>(m_falconVoices[i].source);
+        if (position && audio.isVoicePlaying(m_falconVoices[i].voice)) {
+            audio.setVoicePosition(m_falconVoices[i].voice, position->value);
+            ++i;
+        }
+        else {
+            m_falconVoices[i] = m_falconVoices.back();
+            m_falconVoices.pop_back();
+        }
+    }
+}
@@ -26,27 +26,26 @@ SettingsScreen::SettingsScreen() {
     }
 }
 
-void SettingsScreen::handleEvents(sf::RenderWindow& window) {
+void SettingsScreen::registerInputHandlers(InputEventBus& bus) {
     if (!m_isInitialized) return;
 
-    sf::Event event;
-    while (window.pollEvent(event)) {
+    // Mouse events arrive in virtual coordinates - widgets are laid out in that space
+    auto delegate = [this](const InputEvent& input) {
+        return delegateMouseEvents(input.event);
+    };
+    bus.subscribe(sf::Event::MouseMoved, delegate);
+    bus.subscribe(sf::Event::MouseButtonPressed, delegate);
+    bus.subscribe(sf::Event::MouseButtonReleased, delegate);
 
-        if (delegateMouseEvents(event)) continue;
+    bus.subscribe(sf::Event::KeyPressed, [this](const InputEvent& input) {
+        if (!m_commandHandler) return false;
 
-        if (event.type == sf::Event::Closed) {
-            window.close();
-            return;
+        bool shouldExit = m_commandHandler->handleKeyboardInput(input.event);
+        if (shouldExit) {
+            AppContext::instance().screenManager().changeScreen(ScreenType::MENU);
         }
-
-        if (event.type == sf::Event::KeyPressed && m_commandHandler) {
-            bool shouldExit = m_commandHandler->handleKeyboardInput(event);
-            if (shouldExit) {
-                AppContext::instance().screenManager().changeScreen(ScreenType::MENU);
-                return;
-            }
-        }
-    }
+        return true;
+    });
 }
 
 
@@ -56,6 +55,7 @@ void SettingsScreen::update(float deltaTime) {
     try {
         if (m_uiRenderer) m_uiRenderer->updateAnimation(deltaTime);
         if (m_volumePanel) m_volumePanel->update(deltaTime);
+        if (m_commandHandler) m_commandHandler->update();
     }
     catch (const std::exception& e) {
         std::cout << "Runtime error in Update: " << e.what() << std::endl;
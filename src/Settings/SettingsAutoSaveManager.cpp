@@ -1,9 +1,28 @@
 #include "../UI/VolumeControlPanel.h"
 #include <iostream>
 #include "../Settings/SettingsAutoSaveManager.h"
+#include "SettingsPersistence.h"
 
 SettingsAutoSaveManager::SettingsAutoSaveManager() {}
 
+void SettingsAutoSaveManager::setAutoSaveDelay(float seconds) {
+    m_autoSaveDelay = seconds;
+    SettingsPersistence::instance().setDebounceDelay(seconds);
+}
+
+void SettingsAutoSaveManager::update() {
+    if (!m_autoSaveEnabled) {
+        return;
+    }
+
+    // Cheap when nothing changed; the writer coalesces a drag into one write
+    if (auto panel = m_volumePanel.lock()) {
+        if (panel->hasChanged()) {
+            panel->saveSettings();
+        }
+    }
+}
+
 void SettingsAutoSaveManager::setVolumePanel(std::shared_ptr<VolumeControlPanel> panel) {
     if (panel) {
         m_volumePanel = panel;
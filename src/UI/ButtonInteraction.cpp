@@ -1,4 +1,5 @@
 #include "ButtonInteraction.h"
+#include "LatencyTracker.h"
 
 ButtonInteraction::ButtonInteraction(ButtonModel& model)
     : m_model(model) {
@@ -10,14 +11,17 @@ void ButtonInteraction::handleMouseMove(const sf::Vector2f& mousePos) {
 
     if (m_isHovered && !wasHovered) {
         m_targetScale = 1.1f;
+        LatencyTracker::instance().tagStateChange("button.hover");
     }
     else if (!m_isHovered && wasHovered) {
         m_targetScale = 1.0f;
+        LatencyTracker::instance().tagStateChange("button.hover");
     }
 }
 
 bool ButtonInteraction::handleClick(const sf::Vector2f& mousePos) {
     if (m_model.getBounds().contains(mousePos)) {
+        LatencyTracker::instance().tagStateChange("button.click");
         if (m_callback) {
             m_callback();
         }
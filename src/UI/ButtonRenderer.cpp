@@ -1,10 +1,16 @@
 #include "ButtonRenderer.h"
+#include "EffectShaders.h"
+#include <algorithm>
 
 ButtonRenderer::ButtonRenderer(ButtonModel& model, ButtonInteraction& interaction)
-    : m_model(model), m_interaction(interaction) {
+    : m_model(model), m_interaction(interaction), m_glowQuad(sf::TriangleStrip, 4) {
     m_background.setOutlineColor(sf::Color::White);
     m_background.setOutlineThickness(2);
 
+    m_glow.setFillColor(sf::Color(255, 255, 255, 30));
+    m_glow.setOutlineColor(sf::Color(255, 255, 0, 100));
+    m_glow.setOutlineThickness(3);
+
     m_text.setCharacterSize(24);
     m_text.setStyle(sf::Text::Bold);
 }
@@ -29,23 +35,84 @@ void ButtonRenderer::render(sf::RenderWindow& window) {
     }
 
     if (m_interaction.isHovered()) {
-        sf::RectangleShape glow;
-        glow.setSize(scaledSize + sf::Vector2f(20, 20));
-        glow.setPosition(position - sf::Vector2f(10, 10));
-        glow.setFillColor(sf::Color(255, 255, 255, 30));
-        glow.setOutlineColor(sf::Color(255, 255, 0, 100));
-        glow.setOutlineThickness(3);
-        window.draw(glow);
+        // Single-pass GPU glow when available, otherwise draw the cached glow rectangle
+        if (drawFaceWithShaderGlow(window, position, scaledSize)) {
+            // The shader fills the face only - an untextured button keeps its outline
+            if (!m_model.texture) {
+                m_background.setFillColor(sf::Color::Transparent);
+                window.draw(m_background);
+            }
+        }
+        else {
+            m_glow.setSize(scaledSize + sf::Vector2f(2 * GLOW_MARGIN, 2 * GLOW_MARGIN));
+            m_glow.setPosition(position - sf::Vector2f(GLOW_MARGIN, GLOW_MARGIN));
+            window.draw(m_glow);
+            drawFace(window);
+        }
+    }
+    else {
+        drawFace(window);
     }
 
+    // Image buttons hide their label with a transparent color - skip the draw call
+    if (m_model.textColor.a > 0) {
+        window.draw(m_text);
+    }
+}
+
+void ButtonRenderer::drawFace(sf::RenderWindow& window) {
     if (m_model.texture) {
         window.draw(m_sprite);
     }
     else {
         window.draw(m_background);
     }
+}
+
+bool ButtonRenderer::drawFaceWithShaderGlow(sf::RenderWindow& window, const sf::Vector2f& position, const sf::Vector2f& size) {
+    auto& effects = EffectShaders::instance();
+    sf::Shader* shader = effects.glowShader();
+    if (!shader || size.x <= 0.0f || size.y <= 0.0f) {
+        return false;
+    }
+
+    // Quad is expanded by the glow margin; texture coordinates outside [0,1] become glow
+    sf::Vector2f margin(GLOW_MARGIN / size.x, GLOW_MARGIN / size.y);
+    sf::Vector2f topLeft = position - sf::Vector2f(GLOW_MARGIN, GLOW_MARGIN);
+    sf::Vector2f bottomRight = position + size + sf::Vector2f(GLOW_MARGIN, GLOW_MARGIN);
+
+    // Textured draws use pixel texture coordinates, untextured ones are passed through as-is
+    sf::Vector2f texScale(1.0f, 1.0f);
+    if (m_model.texture) {
+        texScale = sf::Vector2f(static_cast<float>(m_model.texture->getSize().x),
+            static_cast<float>(m_model.texture->getSize().y));
+    }
 
-    window.draw(m_text);
+    sf::Color faceColor = m_model.texture ? sf::Color::White : m_model.backgroundColor;
+    float u0 = -margin.x * texScale.x;
+    float u1 = (1.0f + margin.x) * texScale.x;
+    float v0 = -margin.y * texScale.y;
+    float v1 = (1.0f + margin.y) * texScale.y;
+
+    m_glowQuad[0] = sf::Vertex(topLeft, faceColor, sf::Vector2f(u0, v0));
+    m_glowQuad[1] = sf::Vertex(sf::Vector2f(bottomRight.x, topLeft.y), faceColor, sf::Vector2f(u1, v0));
+    m_glowQuad[2] = sf::Vertex(sf::Vector2f(topLeft.x, bottomRight.y), faceColor, sf::Vector2f(u0, v1));
+    m_glowQuad[3] = sf::Vertex(bottomRight, faceColor, sf::Vector2f(u1, v1));
+
+    // Glow fades in with the hover scale animation (1.0 -> 1.1)
+    float intensity = std::clamp((m_interaction.getHoverScale() - 1.0f) / 0.1f, 0.0f, 1.0f);
+
+    shader->setUniform("hasTexture", m_model.texture != nullptr);
+    shader->setUniform("margin", sf::Glsl::Vec2(margin));
+    shader->setUniform("glowColor", sf::Glsl::Vec4(sf::Color(255, 255, 0, 160)));
+    shader->setUniform("intensity", intensity);
+    shader->setUniform("time", effects.getTime());
+
+    sf::RenderStates states;
+    states.texture = m_model.texture;
+    states.shader = shader;
+    window.draw(m_glowQuad, states);
+    return true;
 }
 
 void ButtonRenderer::updateGraphics() {
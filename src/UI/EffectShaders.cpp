@@ -0,0 +1,97 @@
+#include "EffectShaders.h"
+#include "Logger.h"
+
+namespace {
+    // Texture coordinates outside [0,1] form the glow border around the button face
+    const char* GLOW_FRAGMENT_SHADER = R"(
+        uniform sampler2D texture;
+        uniform bool hasTexture;
+        uniform vec2 margin;
+        uniform vec4 glowColor;
+        uniform float intensity;
+        uniform float time;
+
+        void main()
+        {
+            vec2 uv = gl_TexCoord[0].xy;
+            vec2 outside = max(max(-uv, uv - 1.0), 0.0) / margin;
+            float dist = length(outside);
+
+            if (dist <= 0.0) {
+                vec4 face = hasTexture ? texture2D(texture, uv) * gl_Color : gl_Color;
+                gl_FragColor = face + vec4(glowColor.rgb * 0.12 * intensity, 0.0);
+            }
+            else {
+                float pulse = 0.8 + 0.2 * sin(time * 4.0);
+                float falloff = clamp(1.0 - dist, 0.0, 1.0);
+                gl_FragColor = vec4(glowColor.rgb, glowColor.a * falloff * falloff * intensity * pulse);
+            }
+        }
+    )";
+
+    // Samples the baked glyph coverage twice: once for the text, once offset for the shadow
+    const char* TEXT_SHADOW_FRAGMENT_SHADER = R"(
+        uniform sampler2D texture;
+        uniform vec2 shadowOffset;
+        uniform vec4 textColor;
+        uniform vec4 shadowColor;
+
+        void main()
+        {
+            vec2 uv = gl_TexCoord[0].xy;
+            float textAlpha = textColor.a * texture2D(texture, uv).a;
+            float shadowAlpha = shadowColor.a * texture2D(texture, uv - shadowOffset).a;
+
+            float outAlpha = textAlpha + shadowAlpha * (1.0 - textAlpha);
+            vec3 outColor = (textColor.rgb * textAlpha + shadowColor.rgb * shadowAlpha * (1.0 - textAlpha))
+                / max(outAlpha, 0.0001);
+            gl_FragColor = vec4(outColor, outAlpha);
+        }
+    )";
+}
+
+EffectShaders& EffectShaders::instance() {
+    static EffectShaders instance;
+    return instance;
+}
+
+bool EffectShaders::isAvailable() {
+    if (!m_enabled) {
+        return false;
+    }
+
+    if (!m_compileAttempted) {
+        compile();
+    }
+
+    return m_compiled;
+}
+
+sf::Shader* EffectShaders::glowShader() {
+    return isAvailable() ? &m_glowShader : nullptr;
+}
+
+sf::Shader* EffectShaders::textShadowShader() {
+    return isAvailable() ? &m_textShadowShader : nullptr;
+}
+
+void EffectShaders::compile() {
+    m_compileAttempted = true;
+
+    if (!sf::Shader::isAvailable()) {
+        Logger::log("Shaders not supported - using CPU fallback for UI effects", LogLevel::Warning);
+        return;
+    }
+
+    if (!m_glowShader.loadFromMemory(GLOW_FRAGMENT_SHADER, sf::Shader::Fragment) ||
+        !m_textShadowShader.loadFromMemory(TEXT_SHADOW_FRAGMENT_SHADER, sf::Shader::Fragment)) {
+        Logger::log("Failed to compile UI effect shaders - using CPU fallback", LogLevel::Warning);
+        return;
+    }
+
+    m_glowShader.setUniform("texture", sf::Shader::CurrentTexture);
+    m_textShadowShader.setUniform("texture", sf::Shader::CurrentTexture);
+
+    m_compiled = true;
+    Logger::log("UI effect shaders compiled");
+}
@@ -0,0 +1,60 @@
+#include "HighScoreBoard.h"
+#include <algorithm>
+#include <string>
+
+HighScoreBoard::HighScoreBoard(const sf::Font& font, const HighScoreTable& table, sf::Vector2f center) {
+    const auto& entries = table.entries();
+    std::optional<std::size_t> highlight = table.getLastRank();
+
+    float height = TITLE_SIZE + 30.0f + ROW_SPACING * static_cast<float>(std::max<std::size_t>(entries.size(), 1));
+    sf::Vector2f topLeft(center.x - PANEL_WIDTH / 2.0f, center.y - height / 2.0f);
+
+    m_panel.setSize(sf::Vector2f(PANEL_WIDTH, height));
+    m_panel.setPosition(topLeft);
+    m_panel.setFillColor(sf::Color(0, 0, 0, 150));
+    m_panel.setOutlineColor(sf::Color(255, 215, 0, 180));
+    m_panel.setOutlineThickness(2.0f);
+
+    m_title.setFont(font);
+    m_title.setString("High Scores");
+    m_title.setCharacterSize(TITLE_SIZE);
+    m_title.setFillColor(sf::Color(255, 215, 0));
+    sf::FloatRect titleBounds = m_title.getLocalBounds();
+    m_title.setPosition(center.x - titleBounds.width / 2.0f - titleBounds.left, topLeft.y + 10.0f);
+
+    float y = topLeft.y + TITLE_SIZE + 24.0f;
+    if (entries.empty()) {
+        sf::Text& row = m_rows.emplace_back("No scores yet", font, ROW_SIZE);
+        row.setFillColor(sf::Color(220, 220, 220));
+        row.setPosition(topLeft.x + 30.0f, y);
+        return;
+    }
+
+    // Rank, name and score columns - the font is proportional, so each is its own text
+    m_rows.reserve(entries.size() * 3);
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        sf::Color color = (highlight && *highlight == i + 1) ? sf::Color(255, 215, 0) : sf::Color::White;
+
+        sf::Text& rank = m_rows.emplace_back(std::to_string(i + 1) + ".", font, ROW_SIZE);
+        rank.setPosition(topLeft.x + 30.0f, y);
+
+        sf::Text& name = m_rows.emplace_back(entries[i].name, font, ROW_SIZE);
+        name.setPosition(topLeft.x + 80.0f, y);
+
+        sf::Text& score = m_rows.emplace_back(std::to_string(entries[i].score), font, ROW_SIZE);
+        score.setPosition(topLeft.x + PANEL_WIDTH - 30.0f - score.getLocalBounds().width, y);
+
+        for (auto* text : { &rank, &name, &score }) {
+            text->setFillColor(color);
+        }
+        y += ROW_SPACING;
+    }
+}
+
+void HighScoreBoard::render(sf::RenderWindow& window) const {
+    window.draw(m_panel);
+    window.draw(m_title);
+    for (const auto& row : m_rows) {
+        window.draw(row);
+    }
+}
@@ -0,0 +1,88 @@
+#include "HitTestGrid.h"
+#include <algorithm>
+#include <cmath>
+
+HitTestGrid::HitTestGrid(const sf::Vector2f& area, float cellSize)
+    : m_area(area), m_cellSize(std::max(cellSize, 1.0f)) {
+    m_columns = std::max(1, static_cast<int>(std::ceil(m_area.x / m_cellSize)));
+    m_rows = std::max(1, static_cast<int>(std::ceil(m_area.y / m_cellSize)));
+    m_cells.resize(static_cast<std::size_t>(m_columns * m_rows));
+}
+
+HitTestGrid::WidgetId HitTestGrid::insert(const sf::FloatRect& bounds) {
+    WidgetId id = m_bounds.size();
+    m_bounds.push_back(bounds);
+    addToCells(id, bounds);
+    return id;
+}
+
+void HitTestGrid::setBounds(WidgetId id, const sf::FloatRect& bounds) {
+    if (id >= m_bounds.size()) {
+        return;
+    }
+
+    removeFromCells(id, m_bounds[id]);
+    m_bounds[id] = bounds;
+    addToCells(id, bounds);
+}
+
+void HitTestGrid::clear() {
+    for (auto& cell : m_cells) {
+        cell.clear();
+    }
+    m_bounds.clear();
+    m_hits.clear();
+}
+
+const std::vector<HitTestGrid::WidgetId>& HitTestGrid::query(const sf::Vector2f& point) {
+    m_hits.clear();
+
+    const auto& cell = m_cells[static_cast<std::size_t>(rowAt(point.y) * m_columns + columnAt(point.x))];
+    for (WidgetId id : cell) {
+        if (m_bounds[id].contains(point)) {
+            m_hits.push_back(id);
+        }
+    }
+
+    return m_hits;
+}
+
+int HitTestGrid::columnAt(float x) const {
+    return std::clamp(static_cast<int>(std::floor(x / m_cellSize)), 0, m_columns - 1);
+}
+
+int HitTestGrid::rowAt(float y) const {
+    return std::clamp(static_cast<int>(std::floor(y / m_cellSize)), 0, m_rows - 1);
+}
+
+void HitTestGrid::addToCells(WidgetId id, const sf::FloatRect& bounds) {
+    int left = columnAt(bounds.left);
+    int right = columnAt(bounds.left + bounds.width);
+    int top = rowAt(bounds.top);
+    int bottom = rowAt(bounds.top + bounds.height);
+
+    for (int row = top; row <= bottom; ++row) {
+        for (int column = left; column <= right; ++column) {
+            // Keep each cell sorted so query results come back in insertion order
+            auto& cell = m_cells[static_cast<std::size_t>(row * m_columns + column)];
+            cell.insert(std::lower_bound(cell.begin(), cell.end(), id), id);
+        }
+    }
+}
+
+void HitTestGrid::removeFromCells(WidgetId id, const sf::FloatRect& bounds) {
+    int left = columnAt(bounds.left);
+    int right = columnAt(bounds.left + bounds.width);
+    int top = rowAt(bounds.top);
+    int bottom = rowAt(bounds.top + bounds.height);
+
+    for (int row = top; row <= bottom; ++row) {
+        for (int column = left; column <= right; ++column) {
+            auto& cell = m_cells[static_cast<std::size_t>(row * m_columns + column)];
+            auto it = std::lower_bound(cell.begin(), cell.end(), id);
+            if (it != cell.end() && *it == id) {
+                cell.erase(it);
+            }
+        }
+    }
+}
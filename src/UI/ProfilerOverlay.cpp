@@ -0,0 +1,125 @@
+#include "ProfilerOverlay.h"
+#include "AllocationCounter.h"
+#include "AppContext.h"
+#include "LatencyTracker.h"
+#include "Logger.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+ProfilerOverlay::ProfilerOverlay() {
+    m_text.setCharacterSize(14);
+    m_text.setFillColor(sf::Color(220, 255, 220));
+    m_text.setPosition(16.0f, 14.0f);
+
+    m_panel.setPosition(8.0f, 8.0f);
+    m_panel.setFillColor(sf::Color(0, 0, 0, 170));
+
+    m_allocationMark = AllocationCounter::getThreadCount();
+}
+
+void ProfilerOverlay::update(float deltaTime, std::size_t polledEvents, std::size_t queuedEvents) {
+    m_frameTimeTotal += deltaTime;
+    m_worstFrameTime = std::max(m_worstFrameTime, deltaTime);
+    m_polledEvents += polledEvents;
+    m_queuedEvents += queuedEvents;
+    ++m_frameCount;
+
+    std::uint64_t allocationCount = AllocationCounter::getThreadCount();
+    std::uint64_t frameAllocations = allocationCount - m_allocationMark;
+    m_allocationMark = allocationCount;
+    m_allocations += frameAllocations;
+    m_worstFrameAllocations = std::max(m_worstFrameAllocations, frameAllocations);
+
+    m_refreshTimer += deltaTime;
+    if (m_refreshTimer < REFRESH_INTERVAL) {
+        return;
+    }
+
+    if (m_visible) {
+        rebuildText();
+    }
+
+    m_refreshTimer = 0.0f;
+    m_frameTimeTotal = 0.0f;
+    m_worstFrameTime = 0.0f;
+    m_frameCount = 0;
+    m_polledEvents = 0;
+    m_queuedEvents = 0;
+    m_allocations = 0;
+    m_worstFrameAllocations = 0;
+
+    // Start counting after the text rebuild so the overlay does not report itself
+    m_allocationMark = AllocationCounter::getThreadCount();
+}
+
+void ProfilerOverlay::render(sf::RenderWindow& window) {
+    if (!m_visible || !ensureFont()) {
+        return;
+    }
+
+    window.draw(m_panel);
+    window.draw(m_text);
+}
+
+bool ProfilerOverlay::ensureFont() {
+    if (!m_fontAttempted) {
+        m_fontAttempted = true;
+        try {
+            m_text.setFont(AppContext::instance().getFont("arial.ttf"));
+            m_hasFont = true;
+        }
+        catch (const std::exception& e) {
+            Logger::log("Profiler overlay disabled: " + std::string(e.what()), LogLevel::Warning);
+        }
+    }
+    return m_hasFont;
+}
+
+void ProfilerOverlay::rebuildText() {
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(2);
+
+    float averageMs = m_frameCount ? m_frameTimeTotal / static_cast<float>(m_frameCount) * 1000.0f : 0.0f;
+    text << "Frame " << averageMs << " ms (worst " << m_worstFrameTime * 1000.0f << " ms)\n";
+    text << "Input " << m_polledEvents << " polled -> " << m_queuedEvents << " dispatched\n";
+
+    float averageAllocations = m_frameCount ? static_cast<float>(m_allocations) / static_cast<float>(m_frameCount) : 0.0f;
+    text << "Heap " << averageAllocations << " allocs/frame (worst " << m_worstFrameAllocations << ")\n";
+
+    auto& tracker = LatencyTracker::instance();
+    const auto& latency = tracker.getOverall();
+    if (!tracker.isEnabled()) {
+        text << "Latency: off (F4)";
+    }
+    else if (latency.getCount() == 0) {
+        text << "Latency: waiting for input";
+    }
+    else {
+        text << std::setprecision(1);
+        text << "Latency n=" << latency.getCount()
+            << " mean " << latency.getMeanMs() << " ms"
+            << " p95<=" << latency.getPercentileMs(95.0f) << " ms"
+            << " max " << latency.getMaxMs() << " ms\n";
+
+        // One bar per histogram bucket, scaled to the fullest bucket
+        const auto& buckets = latency.getBuckets();
+        std::uint64_t fullest = std::max<std::uint64_t>(1, *std::max_element(buckets.begin(), buckets.end()));
+        for (std::size_t i = 0; i < buckets.size(); ++i) {
+            if (i < LatencyHistogram::BUCKET_EDGES_MS.size()) {
+                text << "<=" << std::setw(4) << std::setprecision(0) << LatencyHistogram::BUCKET_EDGES_MS[i];
+            }
+            else {
+                text << " >" << std::setw(4) << std::setprecision(0) << LatencyHistogram::BUCKET_EDGES_MS.back();
+            }
+
+            int bar = static_cast<int>(buckets[i] * HISTOGRAM_BAR_WIDTH / fullest);
+            text << " " << std::string(static_cast<std::size_t>(bar), '|') << " " << buckets[i] << "\n";
+        }
+    }
+
+    m_text.setString(text.str());
+
+    sf::FloatRect bounds = m_text.getLocalBounds();
+    m_panel.setSize(sf::Vector2f(bounds.width + 24.0f, bounds.top + bounds.height + 18.0f));
+}
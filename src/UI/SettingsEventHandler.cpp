@@ -27,35 +27,16 @@ void SettingsEventHandler::setVolumePanel(std::shared_ptr<VolumeControlPanel> pa
     }
 }
 
-void SettingsEventHandler::handleEvents(sf::RenderWindow& window) {
-    sf::Event event;
-    while (window.pollEvent(event)) {
-        try {
-            handleWindowEvents(window, event);
-            handleKeyboardEvents(event);
-            handleMouseEvents(event);
-        }
-        catch (const std::exception& e) {
-            std::cout << "Error handling event: " << e.what() << std::endl;
-            window.close();
-        }
-        catch (...) {
-            std::cout << "Unknown error handling event" << std::endl;
-            window.close();
-        }
+void SettingsEventHandler::handleEvent(const sf::Event& event) {
+    try {
+        handleKeyboardEvents(event);
+        handleMouseEvents(event);
     }
-
-    // Detect Escape polling (just in case)
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Escape)) {
-        std::cout << "Escape detected via polling - requesting exit to menu" << std::endl;
-        processEscapeKey();
+    catch (const std::exception& e) {
+        std::cout << "Error handling event: " << e.what() << std::endl;
     }
-}
-
-void SettingsEventHandler::handleWindowEvents(sf::RenderWindow& window, const sf::Event& event) {
-    if (event.type == sf::Event::Closed) {
-        std::cout << "Window close event received" << std::endl;
-        window.close();
+    catch (...) {
+        std::cout << "Unknown error handling event" << std::endl;
     }
 }
 
@@ -13,6 +13,10 @@ void SettingsUIRenderer::initializeTexts() {
     m_titleText.setPosition(570, 70);
     applyTextStyling(m_titleText, sf::Text::Italic);
 
+    // Title and its shadow are baked once and drawn from the cached glyphs
+    m_titleEffect.setText(m_titleText);
+    m_titleEffect.setShadow(m_config.shadowColor, m_config.shadowOffset);
+
     // Setup instruction text  
     setupTextProperties(m_backInstructionText,
         "Press ESC to go back",  
@@ -36,6 +40,7 @@ void SettingsUIRenderer::updateTitleGlowEffect() {
     float glowIntensity = calculateGlowIntensity();
     sf::Color glowColor = calculateGlowColor(glowIntensity);
     m_titleText.setFillColor(glowColor);
+    m_titleEffect.setFillColor(glowColor);
 }
 
 float SettingsUIRenderer::calculateGlowIntensity() const {
@@ -58,33 +63,23 @@ void SettingsUIRenderer::renderBackground(sf::RenderWindow& window, const sf::Sp
 }
 
 void SettingsUIRenderer::renderTexts(sf::RenderWindow& window) {
-    // Render title with shadow effect
+    // Render title with shadow effect (single shader pass when available)
     if (m_shadowEnabled) {
-        sf::Text titleShadow = m_titleText;
-        createShadowEffect(titleShadow, m_titleText, m_config.shadowOffset);
-        window.draw(titleShadow);
+        m_titleEffect.render(window);
+    }
+    else {
+        window.draw(m_titleText);
     }
-
-    // Render main title text
-    window.draw(m_titleText);
 
     // Render instruction text (no shadow needed for smaller text)
     window.draw(m_backInstructionText);
 }
 
-void SettingsUIRenderer::createShadowEffect(sf::Text& shadowText, const sf::Text& originalText, sf::Vector2f offset) {
-    // Configure shadow appearance
-    shadowText.setFillColor(m_config.shadowColor);
-
-    // Position shadow with offset
-    sf::Vector2f originalPos = originalText.getPosition();
-    shadowText.setPosition(originalPos.x + offset.x, originalPos.y + offset.y);
-}
-
 void SettingsUIRenderer::renderAnimationEffects(sf::RenderWindow& window) {}
 
 void SettingsUIRenderer::setTitlePosition(float x, float y) {
     m_titleText.setPosition(x, y);
+    m_titleEffect.setPosition(sf::Vector2f(x, y));
 }
 
 void SettingsUIRenderer::setInstructionPosition(float x, float y) {
@@ -1,8 +1,10 @@
 #include "Slider.h"
+#include "LatencyTracker.h"
 #include <algorithm>
 
 Slider::Slider(sf::Vector2f position, sf::Vector2f size, float minValue, float maxValue)
-    : m_position(position), m_size(size), m_minValue(minValue), m_maxValue(maxValue), m_value(minValue) {
+    : m_position(position), m_size(size), m_hitBounds(position.x, position.y - 10, size.x, size.y + 20),
+    m_minValue(minValue), m_maxValue(maxValue), m_value(minValue) {
 
     m_background.setPosition(position);
     m_background.setSize(size);
@@ -21,7 +23,12 @@ Slider::Slider(sf::Vector2f position, sf::Vector2f size, float minValue, float m
 }
 
 void Slider::setValue(float value) {
+    float previous = m_value;
     m_value = std::clamp(value, m_minValue, m_maxValue);
+    if (m_value != previous) {
+        LatencyTracker::instance().tagStateChange("slider.value");
+    }
+
     updateVisuals();
     if (m_onValueChanged) {
         m_onValueChanged(m_value);
@@ -30,8 +37,7 @@ void Slider::setValue(float value) {
 
 
 bool Slider::handleMouseMove(sf::Vector2f mousePos) {
-    sf::FloatRect bounds(m_position.x, m_position.y - 10, m_size.x, m_size.y + 20);
-    m_isHovered = bounds.contains(mousePos);
+    m_isHovered = m_hitBounds.contains(mousePos);
 
     if (m_isDragging) {
         float newValue = getValueFromPosition(mousePos.x);
@@ -48,8 +54,7 @@ bool Slider::handleMouseMove(sf::Vector2f mousePos) {
 }
 
 bool Slider::handleMousePressed(sf::Vector2f mousePos) {
-    sf::FloatRect bounds(m_position.x, m_position.y - 10, m_size.x, m_size.y + 20);
-    if (bounds.contains(mousePos)) {
+    if (m_hitBounds.contains(mousePos)) {
         m_isDragging = true;
         float newValue = getValueFromPosition(mousePos.x);
         setValue(newValue);
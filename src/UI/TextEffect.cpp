@@ -0,0 +1,151 @@
+#include "TextEffect.h"
+#include "AppContext.h"
+#include "EffectShaders.h"
+#include <algorithm>
+#include <cmath>
+
+void TextEffect::setText(const sf::Text& text) {
+    if (glyphsDiffer(text)) {
+        m_dirty = true;
+    }
+
+    m_text = text;
+    m_fillColor = text.getFillColor();
+    setPosition(text.getPosition());
+}
+
+void TextEffect::setPosition(const sf::Vector2f& position) {
+    m_text.setPosition(position);
+    m_sprite.setPosition(position + m_bakeOrigin);
+}
+
+void TextEffect::setFillColor(const sf::Color& color) {
+    m_fillColor = color;
+}
+
+void TextEffect::setShadow(const sf::Color& color, const sf::Vector2f& offset) {
+    if (offset != m_shadowOffset) {
+        m_dirty = true; // Padding depends on the offset
+    }
+
+    m_shadowColor = color;
+    m_shadowOffset = offset;
+}
+
+void TextEffect::render(sf::RenderTarget& target) {
+    // Follow the window resolution - a minimized window reports no scale
+    float scale = AppContext::instance().layout().getScale();
+    if (scale <= 0.0f) {
+        scale = m_bakeScale;
+    }
+
+    if (m_dirty || scale != m_bakeScale) {
+        bake(scale);
+    }
+
+    if (m_text.getString().isEmpty()) {
+        return;
+    }
+
+    if (!m_cacheValid) {
+        renderUncached(target);
+        return;
+    }
+
+    if (sf::Shader* shader = EffectShaders::instance().textShadowShader()) {
+        renderWithShader(target, *shader);
+    }
+    else {
+        renderCached(target);
+    }
+}
+
+bool TextEffect::glyphsDiffer(const sf::Text& other) const {
+    return m_text.getString() != other.getString() ||
+        m_text.getFont() != other.getFont() ||
+        m_text.getCharacterSize() != other.getCharacterSize() ||
+        m_text.getStyle() != other.getStyle();
+}
+
+void TextEffect::bake(float scale) {
+    m_dirty = false;
+    m_cacheValid = false;
+    m_bakeScale = scale;
+
+    if (m_text.getString().isEmpty() || !m_text.getFont()) {
+        return;
+    }
+
+    // Lay the glyphs out at the size they cover on screen
+    sf::Text glyphs = m_text;
+    glyphs.setCharacterSize(std::max(1u, static_cast<unsigned int>(std::lround(m_text.getCharacterSize() * scale))));
+    glyphs.setOutlineThickness(m_text.getOutlineThickness() * scale);
+
+    // Pad the cache so the shifted shadow sample never leaves the texture
+    sf::FloatRect bounds = glyphs.getLocalBounds();
+    float padding = std::ceil(std::max(std::abs(m_shadowOffset.x), std::abs(m_shadowOffset.y)) * scale) + 2.0f;
+    unsigned int width = static_cast<unsigned int>(std::ceil(bounds.width + 2.0f * padding));
+    unsigned int height = static_cast<unsigned int>(std::ceil(bounds.height + 2.0f * padding));
+
+    sf::RenderTexture canvas;
+    if (!canvas.create(width, height)) {
+        return;
+    }
+
+    // White glyph coverage on transparent white - tinting happens at draw time
+    glyphs.setFillColor(sf::Color::White);
+    glyphs.setPosition(padding - bounds.left, padding - bounds.top);
+
+    canvas.clear(sf::Color(255, 255, 255, 0));
+    canvas.draw(glyphs);
+    canvas.display();
+
+    // Copy into a regular texture so texture coordinates are not flipped
+    if (!m_texture.loadFromImage(canvas.getTexture().copyToImage())) {
+        return;
+    }
+    m_texture.setSmooth(true);
+
+    m_bakeOrigin = sf::Vector2f(bounds.left - padding, bounds.top - padding) / scale;
+    m_sprite.setTexture(m_texture, true);
+    m_sprite.setScale(1.0f / scale, 1.0f / scale);
+    m_sprite.setPosition(m_text.getPosition() + m_bakeOrigin);
+    m_cacheValid = true;
+}
+
+void TextEffect::renderWithShader(sf::RenderTarget& target, sf::Shader& shader) {
+    sf::Vector2u size = m_texture.getSize();
+
+    shader.setUniform("shadowOffset", sf::Glsl::Vec2(
+        m_shadowOffset.x * m_bakeScale / static_cast<float>(size.x),
+        m_shadowOffset.y * m_bakeScale / static_cast<float>(size.y)));
+    shader.setUniform("textColor", sf::Glsl::Vec4(m_fillColor));
+    shader.setUniform("shadowColor", sf::Glsl::Vec4(m_shadowColor));
+
+    m_sprite.setColor(sf::Color::White);
+    target.draw(m_sprite, sf::RenderStates(&shader));
+}
+
+void TextEffect::renderCached(sf::RenderTarget& target) {
+    sf::Vector2f position = m_sprite.getPosition();
+
+    m_sprite.setColor(m_shadowColor);
+    m_sprite.setPosition(position + m_shadowOffset);
+    target.draw(m_sprite);
+
+    m_sprite.setColor(m_fillColor);
+    m_sprite.setPosition(position);
+    target.draw(m_sprite);
+}
+
+void TextEffect::renderUncached(sf::RenderTarget& target) {
+    sf::Vector2f position = m_text.getPosition();
+
+    m_text.setFillColor(m_shadowColor);
+    m_text.setPosition(position + m_shadowOffset);
+    target.draw(m_text);
+
+    m_text.setFillColor(m_fillColor);
+    m_text.setPosition(position);
+    target.draw(m_text);
+}
@@ -1,4 +1,7 @@
 ﻿#include "VolumeControlPanel.h"
+#include "UITheme.h"
+#include "SettingsPersistence.h"
+#include <algorithm>
 #include <iostream>
 
 VolumeControlPanel::VolumeSlider::VolumeSlider(const std::string& labelText,
@@ -41,11 +44,16 @@ float VolumeControlPanel::VolumeSlider::getVolume() const {
 }
 
 VolumeControlPanel::VolumeControlPanel(const sf::Font& font, AudioManager& audio, AudioSettings& settings)
-    : m_position(350, 250), m_audioManager(audio), m_audioSettings(settings) {
+    : m_audioManager(audio), m_audioSettings(settings) {
+
+    // Panel origin comes from the shared theme layout (virtual coordinates)
+    UITheme::Layout layout = UITheme::getDefaultLayout();
+    m_position = sf::Vector2f(layout.labelX, layout.startY);
 
     setupMasterVolumeSlider(font);
     setupMusicVolumeSlider(font);
     setupSFXVolumeSlider(font);
+    buildHitGrid();
 
     refreshFromAudioManager();
 }
@@ -85,6 +93,15 @@ void VolumeControlPanel::setupSFXVolumeSlider(const sf::Font& font) {
     }
 }
 
+void VolumeControlPanel::buildHitGrid() {
+    for (VolumeSlider* volume : { m_masterVolume.get(), m_musicVolume.get(), m_sfxVolume.get() }) {
+        if (volume && volume->slider) {
+            m_sliders.push_back(volume->slider.get());
+            m_hitGrid.insert(volume->slider->getHitBounds());
+        }
+    }
+}
+
 void VolumeControlPanel::update(float deltaTime) {
     if (m_masterVolume && m_masterVolume->slider) m_masterVolume->slider->update(deltaTime);
     if (m_musicVolume && m_musicVolume->slider) m_musicVolume->slider->update(deltaTime);
@@ -110,27 +127,55 @@ void VolumeControlPanel::render(sf::RenderWindow& window) {
 }
 
 bool VolumeControlPanel::handleMouseEvent(const sf::Event& event) {
-    bool handled = false;
-
+    // Moves arrive coalesced from the game loop's input stage
     if (event.type == sf::Event::MouseMoved) {
-        sf::Vector2f mousePos(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
-        if (m_masterVolume && m_masterVolume->slider) handled |= m_masterVolume->slider->handleMouseMove(mousePos);
-        if (m_musicVolume && m_musicVolume->slider) handled |= m_musicVolume->slider->handleMouseMove(mousePos);
-        if (m_sfxVolume && m_sfxVolume->slider) handled |= m_sfxVolume->slider->handleMouseMove(mousePos);
+        return routeMouseMove(sf::Vector2f(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y)));
     }
-    else if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
+
+    if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
         sf::Vector2f mousePos(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y));
-        if (m_masterVolume && m_masterVolume->slider) handled |= m_masterVolume->slider->handleMousePressed(mousePos);
-        if (m_musicVolume && m_musicVolume->slider) handled |= m_musicVolume->slider->handleMousePressed(mousePos);
-        if (m_sfxVolume && m_sfxVolume->slider) handled |= m_sfxVolume->slider->handleMousePressed(mousePos);
+        for (auto id : m_hitGrid.query(mousePos)) {
+            if (m_sliders[id]->handleMousePressed(mousePos)) {
+                m_activeSlider = m_sliders[id];
+                return true;
+            }
+        }
+        return false;
     }
-    else if (event.type == sf::Event::MouseButtonReleased && event.mouseButton.button == sf::Mouse::Left) {
-        if (m_masterVolume && m_masterVolume->slider) handled |= m_masterVolume->slider->handleMouseReleased();
-        if (m_musicVolume && m_musicVolume->slider) handled |= m_musicVolume->slider->handleMouseReleased();
-        if (m_sfxVolume && m_sfxVolume->slider) handled |= m_sfxVolume->slider->handleMouseReleased();
+
+    if (event.type == sf::Event::MouseButtonReleased && event.mouseButton.button == sf::Mouse::Left) {
+        bool handled = m_activeSlider && m_activeSlider->handleMouseReleased();
+        m_activeSlider = nullptr;
+        return handled;
     }
 
-    return handled;
+    return false;
+}
+
+bool VolumeControlPanel::routeMouseMove(const sf::Vector2f& mousePos) {
+    const auto& hits = m_hitGrid.query(mousePos);
+    bool activeNotified = false;
+
+    // Sliders the mouse left still need the move to clear their hover state
+    for (auto id : m_hoveredSliders) {
+        if (std::find(hits.begin(), hits.end(), id) == hits.end()) {
+            m_sliders[id]->handleMouseMove(mousePos);
+            activeNotified |= (m_sliders[id] == m_activeSlider);
+        }
+    }
+
+    for (auto id : hits) {
+        m_sliders[id]->handleMouseMove(mousePos);
+        activeNotified |= (m_sliders[id] == m_activeSlider);
+    }
+
+    // A dragged slider follows the mouse even outside its bounds
+    if (m_activeSlider && !activeNotified) {
+        m_activeSlider->handleMouseMove(mousePos);
+    }
+
+    m_hoveredSliders.assign(hits.begin(), hits.end());
+    return m_activeSlider != nullptr || !hits.empty();
 }
 
 void VolumeControlPanel::refreshFromAudioManager() {
@@ -141,13 +186,18 @@ void VolumeControlPanel::refreshFromAudioManager() {
 }
 
 void VolumeControlPanel::saveSettings() {
-    AudioSettingsManager::save(m_audioSettings);
+    // Debounced - a drag submits many times but settings.txt is written once
+    SettingsPersistence::instance().submit(m_audioSettings);
     m_hasChanged = false;
 }
 
 void VolumeControlPanel::onVolumeChanged(const std::string& type, float value) {
     applyVolumeToAudioManager(type, value);
-    updateAllValueTexts();
+
+    // Only the dragged slider's label changed - the audio buses apply the rest lazily
+    if (type == "master" && m_masterVolume) m_masterVolume->updateValueText();
+    else if (type == "music" && m_musicVolume) m_musicVolume->updateValueText();
+    else if (type == "sfx" && m_sfxVolume) m_sfxVolume->updateValueText();
     m_hasChanged = true;
 }
 
@@ -1,6 +1,15 @@
 ﻿#include "App.h"
+#include "LatencyTracker.h"
+#include <string>
+
+int main(int argc, char* argv[]) {
+    // --measure-latency: record input-to-display latency from the first frame
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--measure-latency") {
+            LatencyTracker::instance().setEnabled(true);
+        }
+    }
 
-int main() {
     App app;
     app.run();
     return 0;